@@ -0,0 +1,44 @@
+#pragma once
+
+#include "skplayer_ui/VideoContainer.h"  // for Chapter
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace skplayer_ui {
+
+// Chapter list formats accepted by ImportChapters().
+//
+//   WebVTT       "WEBVTT" file of chapter cues; the cue start is the chapter
+//                start and the cue text (lines joined by spaces) its title.
+//   Json         [{"start": 12.5, "title": "Intro"}, ...] or an object with
+//                such an array under "chapters". Start keys: start,
+//                startTime, start_time, time (seconds, or "mm:ss" strings)
+//                and startMs, start_ms (milliseconds); title keys: title, name.
+//   Description  Free text with lines such as "00:00 Intro",
+//                "1:02:03 - Part two" or "[12:34] Outro"; lines without a
+//                leading timestamp are ignored.
+//   Auto         Picks one of the above from the first bytes.
+enum class ChapterFormat : uint8_t { Auto, WebVTT, Json, Description };
+
+struct ChapterImportResult {
+    bool ok = false;
+    ChapterFormat format = ChapterFormat::Auto;  // As detected
+    size_t chapters = 0;                         // Appended to the output
+    size_t errorLine = 0;                        // 1-based, when !ok
+    const char* error = nullptr;                 // Static string, when !ok
+};
+
+// Parses `size` bytes (typically a memory-mapped file; no terminator needed)
+// in a single pass and appends the chapters to `out`. Nothing is tokenized or
+// copied up front: each chapter is built in place from the input, and its
+// title string is the only allocation (none for short titles).
+//
+// Start times are parsed to the microsecond and set as Chapter::startUs. They
+// must be strictly increasing, including relative to chapters already in
+// `out`. On any error `out` is left as it was.
+ChapterImportResult ImportChapters(const char* data, size_t size, std::vector<Chapter>& out,
+                                   ChapterFormat format = ChapterFormat::Auto);
+
+} // namespace skplayer_ui
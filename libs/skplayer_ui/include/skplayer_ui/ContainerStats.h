@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace skplayer_ui {
+
+// Parts of the container that issue draw calls.
+enum class Component : uint8_t {
+    SeekBar,             // Track, chapter segments, cue markers, thumb
+    PlayPauseButton,
+    TimeBadge,
+    LiveBadge,
+    SeekFeedback,        // "+ 10" label and chevrons
+    SeekPreviewTooltip,
+};
+inline constexpr size_t kComponentCount = 6;
+
+inline const char* ComponentName(Component c) {
+    switch (c) {
+        case Component::SeekBar: return "seek bar";
+        case Component::PlayPauseButton: return "play/pause";
+        case Component::TimeBadge: return "time badge";
+        case Component::LiveBadge: return "live badge";
+        case Component::SeekFeedback: return "seek feedback";
+        case Component::SeekPreviewTooltip: return "preview tooltip";
+    }
+    return "?";
+}
+
+// Work done by one container. Counts are the library's own calls: SkCanvas
+// draw calls, paths built, text measured and shaped (text served by the
+// shared blob cache costs neither), and the heap allocations the library
+// makes itself (paths, text blobs, caches and strings growing; not Skia's
+// internal ones).
+struct StatsCounters {
+    uint64_t frames = 0;  // render() calls that drew
+    uint64_t drawCalls[kComponentCount] = {};
+    uint64_t pathsBuilt = 0;
+    uint64_t textMeasurements = 0;
+    uint64_t textShapings = 0;
+    uint64_t allocations = 0;
+    uint64_t stateTransitions = 0;
+    uint64_t listenerCallbacks = 0;
+    uint64_t updateNs = 0;  // Standalone update(); a group steps its containers together
+    uint64_t renderNs = 0;
+
+    uint64_t drawCallsFor(Component c) const { return drawCalls[static_cast<size_t>(c)]; }
+    uint64_t totalDrawCalls() const {
+        uint64_t sum = 0;
+        for (uint64_t n : drawCalls) sum += n;
+        return sum;
+    }
+};
+
+// `lastFrame` covers everything since the end of the previous render()
+// (input, update, render) up to the end of the last one; `total` is since
+// creation. Each counter is read atomically, so stats() can be polled from
+// a telemetry thread; a read racing the end of a frame may mix counters
+// from two frames.
+struct ContainerStats {
+    StatsCounters lastFrame;
+    StatsCounters total;
+};
+
+} // namespace skplayer_ui
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+
+namespace skplayer_ui {
+
+// How fast a container wants frames, from its UI state. Ordered by rate.
+enum class FrameRateMode : uint8_t {
+    Idle,     // Paused and at rest: no frames until input or a timer
+    Low,      // Paused or loading, with only fades and shimmer moving
+    Content,  // Plain playback: the video's own rate is enough
+    Max,      // Dragging or seeking: the display's highest rate
+};
+
+inline const char* FrameRateModeName(FrameRateMode mode) {
+    switch (mode) {
+        case FrameRateMode::Idle: return "idle";
+        case FrameRateMode::Low: return "low";
+        case FrameRateMode::Content: return "content";
+        case FrameRateMode::Max: return "max";
+    }
+    return "?";
+}
+
+// The host's rates for each mode: the display's top refresh rate, the
+// video's frame rate and a floor for incidental animation.
+struct FrameRates {
+    float maxHz = 60.0f;
+    float contentHz = 30.0f;
+    float lowHz = 30.0f;
+
+    // 0 for Idle
+    [[nodiscard]] float hz(FrameRateMode mode) const {
+        switch (mode) {
+            case FrameRateMode::Idle: return 0.0f;
+            case FrameRateMode::Low: return lowHz;
+            case FrameRateMode::Content: return contentHz;
+            case FrameRateMode::Max: return maxHz;
+        }
+        return maxHz;
+    }
+};
+
+} // namespace skplayer_ui
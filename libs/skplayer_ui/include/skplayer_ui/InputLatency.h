@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace skplayer_ui {
+
+// What an input event did, for input-to-photon latency accounting.
+enum class Interaction : uint8_t {
+    Tap,            // Show/hide controls (and the LIVE badge)
+    DoubleTapSeek,  // Double-tap or burst seek
+    DragMove,       // Seek bar drag: start, moves and release
+    PlayPause,      // Play/pause button
+};
+inline constexpr size_t kInteractionCount = 4;
+
+inline const char* InteractionName(Interaction kind) {
+    switch (kind) {
+        case Interaction::Tap: return "tap";
+        case Interaction::DoubleTapSeek: return "double-tap seek";
+        case Interaction::DragMove: return "drag move";
+        case Interaction::PlayPause: return "play/pause";
+    }
+    return "?";
+}
+
+// Latency from an input event's timestamp to the presentation of the first
+// frame that reflects it. Percentiles come from a histogram with 1 ms
+// buckets below 128 ms and doubling ones above; count, mean and max are exact.
+struct LatencySummary {
+    uint32_t count = 0;
+    float meanMs = 0.0f;
+    float p50Ms = 0.0f;
+    float p95Ms = 0.0f;
+    float p99Ms = 0.0f;
+    float maxMs = 0.0f;
+};
+
+} // namespace skplayer_ui
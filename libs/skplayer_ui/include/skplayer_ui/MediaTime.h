@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+namespace skplayer_ui {
+
+// Media time in whole microseconds.
+//
+// Positions, durations and chapter/cue times are kept in this form inside
+// the library. A float holds seconds to only 24 bits, so past 18 hours its
+// spacing is ~8 ms and summing per-frame deltas into it drifts; int64
+// microseconds are exact for any realistic length and playback advances by
+// integer addition. Float seconds remain at the API edges (Config, Chapter,
+// CuePoint, Listener::onSeekTo) for convenience, each next to an exact
+// microsecond field or overload; they are converted once, on the way in or out.
+using MediaTimeUs = int64_t;
+
+namespace media_time {
+
+inline constexpr MediaTimeUs kPerSecond = 1'000'000;
+
+// Nearest microsecond
+constexpr MediaTimeUs fromSeconds(double seconds) {
+    const double us = seconds * 1e6;
+    return static_cast<MediaTimeUs>(us < 0.0 ? us - 0.5 : us + 0.5);
+}
+
+constexpr MediaTimeUs fromMillis(int64_t ms) { return ms * 1000; }
+
+constexpr double toSeconds(MediaTimeUs t) { return static_cast<double>(t) / 1e6; }
+
+} // namespace media_time
+
+} // namespace skplayer_ui
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace skplayer_ui {
+
+// A byte-accounted cache that a MemoryGovernor can size and purge.
+// Implementations must be safe to call from the thread driving the governor.
+class MemoryCache {
+public:
+    virtual ~MemoryCache() = default;
+
+    [[nodiscard]] virtual const char* cacheName() const = 0;
+    [[nodiscard]] virtual size_t bytesUsed() const = 0;
+
+    // Trim to `bytes` now and stay within it until the next call.
+    virtual void setByteBudget(size_t bytes) = 0;
+
+    // Drop everything not currently in use (cheap to rebuild on demand).
+    virtual void purgeUnlocked() = 0;
+};
+
+// One memory budget shared by Skia's caches (GPU resources, glyphs, raster
+// caches; adapters live in the app) and library-owned caches (ResourceContext).
+//
+// Budgets are tiered. Each registered cache gets a fixed share of the current
+// tier's total. Memory pressure steps down one tier at a time and purges
+// caches in shed order until usage fits; backgrounding drops straight to the
+// tightest tier. Low-RAM devices can start from a tighter tier table
+// (see Config::ForSystemRam).
+class MemoryGovernor {
+public:
+    enum class Tier : uint8_t { Normal, Reduced, Minimal };
+    static constexpr int kTierCount = 3;
+
+    struct Config {
+        size_t tierBytes[kTierCount] = {
+            128u * 1024 * 1024,  // Normal
+            64u * 1024 * 1024,   // Reduced
+            24u * 1024 * 1024,   // Minimal
+        };
+        Tier initialTier = Tier::Normal;
+
+        // Unlocked resources are purged once after this long without a frame.
+        uint64_t idlePurgeMs = 5000;
+
+        // Tier table scaled to the device: devices with <= 2 GB RAM start at
+        // Reduced and get half-size budgets.
+        static Config ForSystemRam(uint64_t systemRamMb);
+    };
+
+    struct CacheStats {
+        std::string name;
+        size_t bytesUsed = 0;
+        size_t budget = 0;
+    };
+
+    struct Stats {
+        Tier tier = Tier::Normal;
+        size_t budget = 0;
+        size_t bytesUsed = 0;
+        uint32_t lowMemoryEvents = 0;
+        uint32_t idlePurges = 0;
+        std::vector<CacheStats> caches;  // In shed order
+    };
+
+    MemoryGovernor();
+    explicit MemoryGovernor(const Config& config);
+    ~MemoryGovernor();
+
+    MemoryGovernor(const MemoryGovernor&) = delete;
+    MemoryGovernor& operator=(const MemoryGovernor&) = delete;
+
+    // `share` is the cache's fraction of each tier's total. Lower `shedOrder`
+    // is purged first under pressure. The cache must outlive its registration.
+    void registerCache(MemoryCache* cache, float share, int shedOrder);
+    void unregisterCache(MemoryCache* cache);
+
+    [[nodiscard]] Tier tier() const;
+    void setTier(Tier tier);
+
+    // Memory pressure: step one tier tighter, then purge in shed order until
+    // usage fits the new budget.
+    void onLowMemory();
+
+    // App hidden: drop to Minimal and purge every cache.
+    void onEnterBackground();
+
+    // App visible again: restore the configured tier (pressure is forgotten).
+    void onEnterForeground();
+
+    // Call once per loop iteration; `renderedFrame` marks activity.
+    void tick(uint64_t nowMs, bool renderedFrame);
+
+    // True while an idle purge is still due (hosts that sleep between frames
+    // should wake for it, see Config::idlePurgeMs).
+    [[nodiscard]] bool idlePurgePending() const;
+
+    [[nodiscard]] Stats stats() const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+} // namespace skplayer_ui
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "skplayer_ui/MemoryGovernor.h"
+
+#include <memory>
+
+class SkTypeface;
+
+namespace skplayer_ui {
+
+struct DpiResources;  // Defined in src/DpiResources.h (library-internal)
+
+// Shareable, reference-counted resources for any number of VideoContainers.
+// Holds the overlay typeface plus everything derived from (typeface, DPI):
+// resolved theme metrics, pre-built icon paths, fonts and cached text blobs.
+//
+// Create one per screen (or per app) and pass it through
+// `VideoContainer::Config::resources`; containers without one get a private
+// context. Thread-safe: containers may be constructed from several threads.
+//
+// As a MemoryCache it reports icon/atlas/text-blob bytes to a MemoryGovernor;
+// budgets and purges only affect the text blob caches (rebuilt on demand).
+class ResourceContext : public MemoryCache {
+public:
+    // `typeface` may be null (Skia default typeface). The context keeps a ref.
+    static std::shared_ptr<ResourceContext> Make(SkTypeface* typeface = nullptr);
+
+    ~ResourceContext() override;
+
+    ResourceContext(const ResourceContext&) = delete;
+    ResourceContext& operator=(const ResourceContext&) = delete;
+
+    [[nodiscard]] SkTypeface* typeface() const;
+
+    // Replaces the typeface, e.g. once a platform font finishes loading off
+    // the startup path. Text drawn before then uses Skia's default typeface.
+    // Call from the thread that renders, between frames; containers pick up
+    // the new fonts on their next render.
+    void setTypeface(SkTypeface* typeface);
+
+    // Library-internal: resources resolved for `dpiScale`. Built on first use,
+    // then shared (and address-stable) for the lifetime of the context.
+    const DpiResources& forDpi(float dpiScale);
+
+    // MemoryCache
+    [[nodiscard]] const char* cacheName() const override { return "skplayer_ui.resources"; }
+    [[nodiscard]] size_t bytesUsed() const override;
+    void setByteBudget(size_t bytes) override;
+    void purgeUnlocked() override;
+
+private:
+    explicit ResourceContext(SkTypeface* typeface);
+
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+} // namespace skplayer_ui
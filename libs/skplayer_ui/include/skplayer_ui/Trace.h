@@ -0,0 +1,23 @@
+#pragma once
+
+namespace skplayer_ui {
+
+// Trace events from the library's hot paths (update, render and each
+// component's render, pointer handlers, state transitions). Compiled in only
+// with the CMake option SKPLAYER_UI_ENABLE_TRACING; otherwise the
+// instrumentation expands to nothing and ExportTrace() returns false.
+#if defined(SKPLAYER_UI_TRACING) && SKPLAYER_UI_TRACING
+inline constexpr bool kTracingCompiledIn = true;
+#else
+inline constexpr bool kTracingCompiledIn = false;
+#endif
+
+// Writes every event recorded so far, from all threads, as Chrome trace
+// event JSON (chrome://tracing, ui.perfetto.dev). Timestamps are the steady
+// clock in microseconds, i.e. CLOCK_MONOTONIC on Android and Linux, the
+// clock platform traces use. May run while other threads keep recording;
+// their newer events are left out. False if tracing is compiled out or the
+// file can't be written.
+bool ExportTrace(const char* path);
+
+} // namespace skplayer_ui
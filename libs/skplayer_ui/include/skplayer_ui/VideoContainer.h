@@ -1,5 +1,11 @@
 #pragma once
 
+#include "skplayer_ui/ContainerStats.h"
+#include "skplayer_ui/FrameRate.h"
+#include "skplayer_ui/InputLatency.h"
+#include "skplayer_ui/MediaTime.h"
+#include "skplayer_ui/ResourceContext.h"
+
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -14,9 +20,26 @@ namespace skplayer_ui {
 struct Chapter {
     float startTime = 0.0f;
     std::string title;
+    MediaTimeUs startUs = -1;  // Used instead of startTime when >= 0
 
+    Chapter() = default;
     explicit Chapter(float start, std::string t = "")
         : startTime(start), title(std::move(t)) {}
+
+    // Exact start; startTime is filled in for display
+    static Chapter AtUs(MediaTimeUs start, std::string t = "") {
+        Chapter chapter(static_cast<float>(media_time::toSeconds(start)), std::move(t));
+        chapter.startUs = start;
+        return chapter;
+    }
+};
+
+// Ad break or interactive cue, drawn as a tick on the track. `id` is the
+// host's own tag, passed back in Listener::onCuePoint.
+struct CuePoint {
+    float time = 0.0f;
+    uint32_t id = 0;
+    MediaTimeUs timeUs = -1;  // Used instead of time when >= 0
 };
 
 // High-level UI/controller for the demo "video" surface.
@@ -29,23 +52,41 @@ struct Chapter {
 // - forward pointer events
 // - call update(dt, nowMs)
 // - call render(canvas)
+// and may sleep until nextDeadlineMs() instead of ticking every vsync.
 class VideoContainer {
 public:
+    static constexpr uint64_t kNoDeadline = UINT64_MAX;
+
     struct Listener {
         virtual ~Listener() = default;
         virtual void onPlay() {}
         virtual void onPause() {}
         virtual void onSeekTo(float /*positionSeconds*/) {}
+        // Exact form of onSeekTo, called by the container. Override this one
+        // for long media; the default forwards to onSeekTo().
+        virtual void onSeekToUs(MediaTimeUs positionUs) {
+            onSeekTo(static_cast<float>(media_time::toSeconds(positionUs)));
+        }
+        // Playback crossed `cue` (once per pass: seeking over a cue skips it,
+        // seeking back before it arms it again). Called from update().
+        virtual void onCuePoint(const CuePoint& /*cue*/) {}
     };
 
     struct Config {
         float durationSeconds = 0.0f;
+        MediaTimeUs durationUs = 0;  // Used instead of durationSeconds when set
         std::vector<Chapter> chapters;
         float initialLoadingSeconds = 0.0f;
         float dpiScale = 1.0f;
 
-        // Optional typeface for overlay text (caller retains ownership)
+        // Optional typeface for overlay text (caller retains ownership).
+        // Ignored when `resources` is set.
         SkTypeface* overlayTypeface = nullptr;
+
+        // Optional shared resources (typeface, icon paths, fonts, text blobs,
+        // resolved metrics). Share one across many containers (e.g. a feed) to
+        // avoid rebuilding them per instance; null = private context.
+        std::shared_ptr<ResourceContext> resources;
     };
 
     explicit VideoContainer(const Config& config, Listener* listener = nullptr);
@@ -66,20 +107,105 @@ public:
     // videoCenterY: Y coordinate of video center relative to container (for centering play button/chevrons)
     void setLayout(bool portrait, float videoCenterY);
 
-    // Input (pixel coordinates)
-    void onPointerDown(float x, float y, uint64_t nowMs, bool forceDoubleTap = false);
-    void onPointerMove(float x, float y);
-    void onPointerUp(float x, float y);
+    // Replace the chapter list (sorted by start time), e.g. with the output of
+    // ImportChapters(). Taken by value so a large list can be moved in.
+    void setChapters(std::vector<Chapter> chapters);
+
+    // Replace the cue points (sorted here; any order accepted). Cues before
+    // the current position count as already crossed.
+    void setCuePoints(std::vector<CuePoint> cues);
+
+    // Live/DVR mode. The first call switches the container to live: the bar
+    // spans the seekable window [startSeconds, endSeconds] of stream time
+    // (endSeconds is the live edge), positions passed to Listener::onSeekTo
+    // are stream times, and the time badge becomes a LIVE badge that jumps
+    // back to the edge when tapped. Call again whenever the window slides;
+    // chapters that end before the window are dropped. Playback that reaches
+    // the edge follows it rather than pausing.
+    void setLiveWindow(float startSeconds, float endSeconds);
+    void setLiveWindowUs(MediaTimeUs startUs, MediaTimeUs endUs);
+
+    // Adds a chapter at the live edge. Returns false (and ignores it) unless
+    // it starts after the last chapter.
+    bool appendChapter(Chapter chapter);
+
+    // Seek to the live edge and play (the LIVE badge's action).
+    void jumpToLive();
+
+    [[nodiscard]] bool isLive() const;
+    [[nodiscard]] bool isAtLiveEdge() const;
+
+    // Switch to another DPI scale (e.g. the window moved to another display).
+    // Layout is recomputed only here and in setViewport()/setLayout().
+    void setDpiScale(float dpiScale);
+
+    // Input (pixel coordinates). `inputTimeNs` is optional: when the event
+    // happened (e.g. SDL's event timestamp), on the clock later passed to
+    // onFramePresented(). Timestamped events feed inputLatency().
+    void onPointerDown(float x, float y, uint64_t nowMs, bool forceDoubleTap = false, uint64_t inputTimeNs = 0);
+    void onPointerMove(float x, float y, uint64_t inputTimeNs = 0);
+    void onPointerUp(float x, float y, uint64_t inputTimeNs = 0);
 
     // Tick/update
     void update(float deltaTimeSeconds, uint64_t nowMs);
 
+    // When update()/render() are next needed, on the `nowMs` clock: the last
+    // update's time if a frame is due now (animating, or input since then),
+    // a future time for pending timers and playback progress, or kNoDeadline
+    // when the UI is at rest until new input.
+    [[nodiscard]] uint64_t nextDeadlineMs() const;
+
+    // Optional, before render(): when the coming frame is expected on screen,
+    // on the inputTimeNs clock. During a drag the preview thumb and tooltip
+    // are extrapolated to that time from the timestamped moves' velocity;
+    // the seek committed on release still uses the last touch.
+    void setExpectedPresentTime(uint64_t presentTimeNs);
+
     // Draw
     void render(SkCanvas* canvas);
 
+    // The frame holding the last render() reached the screen (e.g. right
+    // after the buffer swap). Closes out latency samples for input it reflects.
+    void onFramePresented(uint64_t presentTimeNs);
+
+    // Input-to-photon latency per interaction since creation or the last reset
+    [[nodiscard]] LatencySummary inputLatency(Interaction kind) const;
+    void resetInputLatency();
+
+    // Draw calls per component, paths built, text measured and shaped,
+    // allocations, state transitions, listener callbacks and update/render
+    // time: for the last frame and since creation. Cheap to keep (relaxed
+    // counters) and safe to call from any thread, e.g. to sample telemetry.
+    [[nodiscard]] ContainerStats stats() const;
+
     [[nodiscard]] bool isLoading() const;
+    [[nodiscard]] bool isPlaying() const;
+
+    // Frame rate the UI needs as of the last update(), for the host to map
+    // to a swap interval or the platform's refresh-rate API (see FrameRates).
+    // Speeding up is immediate; slowing down waits out a short hold.
+    [[nodiscard]] FrameRateMode frameRateMode() const;
+
+    // Playback position as of the last update() (stream time in live mode)
+    [[nodiscard]] MediaTimeUs positionUs() const;
+
+    // Instant resume: UI state, position, live window, chapters, cues,
+    // seek burst and feedback, and the computed layout as one compact blob.
+    // Take it on the UI thread; the bytes are self-contained, so writing
+    // them to disk can happen on any thread. Native byte order: for the
+    // same build on the same device (e.g. across an activity restart).
+    [[nodiscard]] std::vector<uint8_t> snapshot() const;
+
+    // Replaces this container's state with a snapshot's (typically straight
+    // from a read or mapped file; chapters are copied, not parsed). `nowMs`
+    // is the host clock now, re-basing the burst timer. No listener calls.
+    // False, and the container unchanged, if the data is truncated, corrupt
+    // or from another format version.
+    bool restore(const void* data, size_t size, uint64_t nowMs);
 
 private:
+    friend class VideoContainerGroup;
+
     class Impl;
     std::unique_ptr<Impl> impl;
 };
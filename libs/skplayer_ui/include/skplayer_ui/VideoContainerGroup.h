@@ -0,0 +1,68 @@
+#pragma once
+
+#include "skplayer_ui/ResourceContext.h"
+#include "skplayer_ui/VideoContainer.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class SkCanvas;
+
+namespace skplayer_ui {
+
+// Batch owner for many simultaneous VideoContainers (e.g. a feed of inline
+// players). Instead of N independent `update()` calls, the group owns the
+// animation state of all its containers in structure-of-arrays lanes, keeps
+// the rows of the active set (containers that are animating, playing or
+// waiting on a timer) packed at the front and advances those in one pass.
+// Containers read their row in place, so they behave the same in and out of
+// a group. Resting containers are skipped until input or a layout change
+// wakes them.
+//
+// After `update()`, `changed()` lists the handles whose visuals moved; only
+// those need to be re-rendered (assuming the host keeps the previous pixels).
+//
+// Reentrancy: Listener callbacks fire from inside `update()`. They may call
+// `add()`, `remove()` and any method of `container()`, including on the
+// container whose callback is running. A `remove()` made there is deferred
+// until `update()` returns: the handle stays valid (and counted by `size()`)
+// for the rest of the pass, the container is still stepped in it, and it is
+// left out of `changed()`. Containers added or woken from a callback
+// are first stepped by the next `update()`. Calling `update()` itself from a
+// callback does nothing.
+class VideoContainerGroup {
+public:
+    using Handle = uint32_t;
+
+    // Containers added without `Config::resources` share this context.
+    explicit VideoContainerGroup(std::shared_ptr<ResourceContext> resources = nullptr);
+    ~VideoContainerGroup();
+
+    VideoContainerGroup(const VideoContainerGroup&) = delete;
+    VideoContainerGroup& operator=(const VideoContainerGroup&) = delete;
+
+    Handle add(VideoContainer::Config config, VideoContainer::Listener* listener = nullptr);
+    void remove(Handle handle);
+
+    // Forward input/layout through the container as usual; doing so wakes it.
+    VideoContainer& container(Handle handle);
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] size_t activeCount() const;
+
+    void update(float deltaTimeSeconds, uint64_t nowMs);
+
+    // Earliest VideoContainer::nextDeadlineMs() over all containers.
+    [[nodiscard]] uint64_t nextDeadlineMs() const;
+
+    // Handles whose state changed during the last update (or since, via input).
+    [[nodiscard]] const std::vector<Handle>& changed() const;
+
+    void render(Handle handle, SkCanvas* canvas);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+} // namespace skplayer_ui
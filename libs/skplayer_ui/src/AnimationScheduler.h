@@ -0,0 +1,82 @@
+// libs/skplayer_ui/src/AnimationScheduler.h
+#pragma once
+
+#include "MotionLanes.h"
+#include "Theme.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace skplayer_ui {
+
+inline constexpr uint64_t kNoDeadline = std::numeric_limits<uint64_t>::max();
+
+// =============================================================================
+// Deadlines
+// =============================================================================
+//
+// Collects the earliest host-clock time (the `nowMs` passed to update()) at
+// which something on screen changes. Animations in flight need the very next
+// frame; timers (auto-hide, burst timeout, feedback fade) only need a frame
+// when they fire, so the host can sleep until then.
+
+class DeadlineSet {
+public:
+    explicit DeadlineSet(uint64_t nowMs) : now_(nowMs) {}
+
+    void frameNow() { earliest_ = now_; }
+
+    void at(uint64_t ms) { earliest_ = std::min(earliest_, std::max(ms, now_)); }
+
+    // Rounded up so that the timer has expired by the time the host wakes.
+    void after(float seconds) {
+        if (seconds <= 0.0f) { frameNow(); return; }
+        at(now_ + static_cast<uint64_t>(std::ceil(seconds * 1000.0f)));
+    }
+
+    void afterUs(MediaTimeUs us) {
+        if (us <= 0) { frameNow(); return; }
+        at(now_ + static_cast<uint64_t>((us + 999) / 1000));
+    }
+
+    bool empty() const { return earliest_ == kNoDeadline; }
+    uint64_t earliest() const { return earliest_; }
+
+private:
+    uint64_t now_;
+    uint64_t earliest_ = kNoDeadline;
+};
+
+namespace motion {
+
+// True once every smoothed channel has snapped to its target and no
+// frame-driven effect (ripple, pulse, particles, loading shimmer) is running.
+inline bool isSettled(const MotionRef& m) {
+    for (int j = 0; j < kMaxParticles; ++j) {
+        if (m.particleAge(j) < theme::chevron::kParticleDurationSeconds) return false;
+    }
+    return m.controlsAlpha() == m.controlsTarget() && m.thumbScale() == m.thumbTarget() &&
+           m.morph() == m.morphTarget() && m.rippleActive() == 0.0f && m.feedbackPulse() == 0.0f &&
+           m.loadingActive() == 0.0f;
+}
+
+// Adds the deadlines implied by one row's animations and timers. Playback
+// position is left to the caller, which knows whether progress is on screen.
+inline void collectDeadlines(const MotionRef& m, DeadlineSet& d) {
+    if (!isSettled(m)) d.frameNow();
+
+    if (m.autoHideActive() > 0.0f) d.after(m.autoHide());
+    if (m.idleCounting() > 0.0f && m.controlsTarget() > 0.0f) {
+        d.after(theme::seekbar::kAutoHideDelaySeconds - m.idleSeconds());
+    }
+    // Feedback text is static until its fade-out starts, then gone at zero
+    if (m.feedbackTimer() > 0.0f) {
+        d.after(m.feedbackTimer() - theme::layout::kFeedbackFadeOutSeconds);
+    }
+}
+
+} // namespace motion
+
+} // namespace skplayer_ui
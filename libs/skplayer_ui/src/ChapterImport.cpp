@@ -0,0 +1,638 @@
+#include "skplayer_ui/ChapterImport.h"
+#include "skplayer_ui/MediaTime.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace skplayer_ui {
+
+namespace {
+
+// =============================================================================
+// Input
+// =============================================================================
+
+struct Span {
+    const char* begin;
+    const char* end;
+
+    [[nodiscard]] bool empty() const { return begin == end; }
+    [[nodiscard]] size_t size() const { return static_cast<size_t>(end - begin); }
+
+    [[nodiscard]] bool equals(const char* literal) const {
+        const size_t n = std::strlen(literal);
+        return size() == n && std::memcmp(begin, literal, n) == 0;
+    }
+
+    [[nodiscard]] bool startsWith(const char* literal) const {
+        const size_t n = std::strlen(literal);
+        return size() >= n && std::memcmp(begin, literal, n) == 0;
+    }
+
+    [[nodiscard]] bool contains(const char* literal) const {
+        const size_t n = std::strlen(literal);
+        for (const char* p = begin; p + n <= end; ++p) {
+            if (std::memcmp(p, literal, n) == 0) return true;
+        }
+        return false;
+    }
+};
+
+bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+bool IsBlank(char c) { return c == ' ' || c == '\t'; }
+
+Span Trim(Span s) {
+    while (s.begin < s.end && IsBlank(*s.begin)) ++s.begin;
+    while (s.end > s.begin && IsBlank(s.end[-1])) --s.end;
+    return s;
+}
+
+struct Cursor {
+    const char* p;
+    const char* end;
+    size_t line = 1;  // Of the next unread byte
+
+    [[nodiscard]] bool atEnd() const { return p >= end; }
+    [[nodiscard]] char peek() const { return p < end ? *p : '\0'; }
+
+    // One line without its "\n" or "\r\n"; moves to the start of the next.
+    Span nextLine() {
+        const char* begin = p;
+        const auto* nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        const char* stop = nl ? nl : end;
+        p = nl ? nl + 1 : end;
+        ++line;
+        if (stop > begin && stop[-1] == '\r') --stop;
+        return {begin, stop};
+    }
+};
+
+// [[h:]m:]s[.fff] (',' also accepted as the decimal mark), to the nearest
+// microsecond. Minutes and seconds after a ':' must be below 60. Advances `p`
+// past the timestamp.
+bool ParseClock(const char*& p, const char* end, bool requireColon, MediaTimeUs* time) {
+    const char* q = p;
+    uint32_t fields[3] = {0, 0, 0};
+    int count = 0;
+    for (;;) {
+        if (q >= end || !IsDigit(*q)) return false;
+        uint32_t value = 0;
+        int digits = 0;
+        while (q < end && IsDigit(*q)) {
+            if (++digits > 9) return false;
+            value = value * 10 + static_cast<uint32_t>(*q - '0');
+            ++q;
+        }
+        fields[count++] = value;
+        if (count == 3 || q + 1 >= end || *q != ':' || !IsDigit(q[1])) break;
+        ++q;
+    }
+    if (requireColon && count < 2) return false;
+    for (int i = 1; i < count; ++i) {
+        if (fields[i] >= 60) return false;
+    }
+
+    MediaTimeUs total = 0;
+    for (int i = 0; i < count; ++i) total = total * 60 + fields[i];
+    total *= media_time::kPerSecond;
+    if (q + 1 < end && (*q == '.' || *q == ',') && IsDigit(q[1])) {
+        ++q;
+        MediaTimeUs scale = media_time::kPerSecond / 10;
+        for (; q < end && IsDigit(*q); ++q) {
+            if (scale > 0) {
+                total += (*q - '0') * scale;
+                scale /= 10;
+            } else if (scale == 0) {
+                if (*q >= '5') ++total;  // Rounds on the first digit past microseconds
+                scale = -1;
+            }
+        }
+    }
+    *time = total;
+    p = q;
+    return true;
+}
+
+// =============================================================================
+// Output
+// =============================================================================
+
+// Appends to the caller's vector, enforcing increasing start times, and can
+// undo everything it appended.
+class Emitter {
+public:
+    explicit Emitter(std::vector<Chapter>& out) : out_(out), initial_(out.size()), last_(-1) {
+        if (!out.empty()) {
+            const Chapter& back = out.back();
+            last_ = back.startUs >= 0 ? back.startUs : media_time::fromSeconds(back.startTime);
+        }
+    }
+
+    // nullptr, or why the chapter was rejected
+    const char* add(MediaTimeUs start, std::string&& title) {
+        if (start < 0) return "negative start time";
+        if (start <= last_) return "chapter start times must increase";
+        out_.push_back(Chapter::AtUs(start, std::move(title)));
+        last_ = start;
+        return nullptr;
+    }
+
+    [[nodiscard]] size_t added() const { return out_.size() - initial_; }
+    void rollback() { out_.erase(out_.begin() + static_cast<std::ptrdiff_t>(initial_), out_.end()); }
+
+private:
+    std::vector<Chapter>& out_;
+    size_t initial_;
+    MediaTimeUs last_;
+};
+
+struct Failure {
+    const char* error = nullptr;
+    size_t line = 0;
+};
+
+// =============================================================================
+// WebVTT
+// =============================================================================
+
+Failure ParseWebVTT(Cursor& c, Emitter& emit) {
+    const Span header = c.nextLine();
+    if (!header.startsWith("WEBVTT") || (header.size() > 6 && !IsBlank(header.begin[6]))) {
+        return {"missing WEBVTT header", 1};
+    }
+    while (!c.atEnd() && !Trim(c.nextLine()).empty()) {}
+
+    while (!c.atEnd()) {
+        size_t lineNo = c.line;
+        const Span first = Trim(c.nextLine());
+        if (first.empty()) continue;
+
+        // Comment, style and region blocks carry no cues
+        if (first.equals("NOTE") || first.startsWith("NOTE ") || first.startsWith("NOTE\t") ||
+            first.equals("STYLE") || first.equals("REGION")) {
+            while (!c.atEnd() && !Trim(c.nextLine()).empty()) {}
+            continue;
+        }
+
+        // An optional cue identifier precedes the timing line
+        Span timing = first;
+        if (!timing.contains("-->")) {
+            if (c.atEnd()) break;
+            lineNo = c.line;
+            timing = Trim(c.nextLine());
+            if (!timing.contains("-->")) {
+                // Not a cue: skip the block
+                while (!timing.empty() && !c.atEnd()) timing = Trim(c.nextLine());
+                continue;
+            }
+        }
+
+        const char* p = timing.begin;
+        MediaTimeUs start = 0;
+        if (!ParseClock(p, timing.end, true, &start)) return {"bad cue timestamp", lineNo};
+
+        // Cue text up to the next blank line; continuation lines join with spaces
+        std::string title;
+        while (!c.atEnd()) {
+            const Span text = Trim(c.nextLine());
+            if (text.empty()) break;
+            if (!title.empty()) title += ' ';
+            title.append(text.begin, text.end);
+        }
+        if (const char* error = emit.add(start, std::move(title))) return {error, lineNo};
+    }
+    return {};
+}
+
+// =============================================================================
+// Description text
+// =============================================================================
+
+bool IsSeparator(char c) { return IsBlank(c) || c == '-' || c == ':' || c == '|' || c == '.'; }
+
+// En and em dashes, as UTF-8
+size_t DashBytes(const char* p, const char* end) {
+    if (end - p >= 3 && static_cast<uint8_t>(p[0]) == 0xE2 && static_cast<uint8_t>(p[1]) == 0x80 &&
+        (static_cast<uint8_t>(p[2]) == 0x93 || static_cast<uint8_t>(p[2]) == 0x94)) {
+        return 3;
+    }
+    return 0;
+}
+
+Failure ParseDescription(Cursor& c, Emitter& emit) {
+    while (!c.atEnd()) {
+        const size_t lineNo = c.line;
+        const Span line = Trim(c.nextLine());
+        const char* p = line.begin;
+
+        const char open = p < line.end ? *p : '\0';
+        const bool bracketed = open == '(' || open == '[';
+        if (bracketed) ++p;
+
+        MediaTimeUs start = 0;
+        if (!ParseClock(p, line.end, true, &start)) continue;
+        if (bracketed) {
+            if (p >= line.end || *p != (open == '(' ? ')' : ']')) continue;
+            ++p;
+        }
+        // "12:34pm" and the like are prose, not chapters
+        if (p < line.end && !IsSeparator(*p) && !DashBytes(p, line.end)) continue;
+
+        while (p < line.end) {
+            if (IsSeparator(*p)) {
+                ++p;
+            } else if (const size_t n = DashBytes(p, line.end)) {
+                p += n;
+            } else {
+                break;
+            }
+        }
+        if (const char* error = emit.add(start, std::string(p, line.end))) return {error, lineNo};
+    }
+    return {};
+}
+
+// =============================================================================
+// JSON
+// =============================================================================
+
+class JsonParser {
+public:
+    JsonParser(Cursor& c, Emitter& emit) : c_(c), emit_(emit) {}
+
+    Failure parse() {
+        skipWs();
+        if (c_.peek() == '[') {
+            parseChapters();
+        } else if (c_.peek() == '{') {
+            bool found = false;
+            parseObject([&](const Span& key) {
+                if (!key.equals("chapters") || found) return skipValue(0);
+                found = true;
+                return parseChapters();
+            });
+            if (!failure_.error && !found) fail("no \"chapters\" array");
+        } else {
+            fail("expected '[' or '{'");
+        }
+        if (failure_.error) return failure_;
+
+        skipWs();
+        if (!c_.atEnd()) fail("unexpected data after the chapter list");
+        return failure_;
+    }
+
+private:
+    static constexpr int kMaxDepth = 64;
+
+    bool fail(const char* error) {
+        if (!failure_.error) failure_ = {error, c_.line};
+        return false;
+    }
+
+    void skipWs() {
+        while (c_.p < c_.end) {
+            const char ch = *c_.p;
+            if (ch == '\n') {
+                ++c_.line;
+            } else if (ch != ' ' && ch != '\t' && ch != '\r') {
+                return;
+            }
+            ++c_.p;
+        }
+    }
+
+    bool expect(char ch) {
+        skipWs();
+        if (c_.peek() != ch) return fail("malformed JSON");
+        ++c_.p;
+        return true;
+    }
+
+    // The raw bytes between the quotes; `escaped` if they need decoding.
+    bool scanString(Span* raw, bool* escaped) {
+        if (!expect('"')) return false;
+        const char* begin = c_.p;
+        *escaped = false;
+        while (c_.p < c_.end) {
+            const char ch = *c_.p;
+            if (ch == '"') {
+                *raw = {begin, c_.p};
+                ++c_.p;
+                return true;
+            }
+            if (ch == '\\') {
+                *escaped = true;
+                if (c_.end - c_.p < 2) break;
+                c_.p += 2;
+                continue;
+            }
+            if (static_cast<uint8_t>(ch) < 0x20) return fail("control character in string");
+            ++c_.p;
+        }
+        return fail("unterminated string");
+    }
+
+    static void AppendUtf8(std::string& out, uint32_t cp) {
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (cp >> 18));
+            out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+
+    static bool Hex4(const char* p, const char* end, uint32_t* value) {
+        if (end - p < 4) return false;
+        uint32_t v = 0;
+        for (int i = 0; i < 4; ++i) {
+            const char ch = p[i];
+            v <<= 4;
+            if (ch >= '0' && ch <= '9') v |= static_cast<uint32_t>(ch - '0');
+            else if (ch >= 'a' && ch <= 'f') v |= static_cast<uint32_t>(ch - 'a' + 10);
+            else if (ch >= 'A' && ch <= 'F') v |= static_cast<uint32_t>(ch - 'A' + 10);
+            else return false;
+        }
+        *value = v;
+        return true;
+    }
+
+    bool decodeString(const Span& raw, std::string* out) {
+        out->reserve(raw.size());
+        for (const char* p = raw.begin; p < raw.end; ++p) {
+            if (*p != '\\') {
+                *out += *p;
+                continue;
+            }
+            if (++p >= raw.end) return fail("bad escape");
+            switch (*p) {
+                case '"': case '\\': case '/': *out += *p; break;
+                case 'b': *out += '\b'; break;
+                case 'f': *out += '\f'; break;
+                case 'n': *out += '\n'; break;
+                case 'r': *out += '\r'; break;
+                case 't': *out += '\t'; break;
+                case 'u': {
+                    uint32_t cp = 0;
+                    if (!Hex4(p + 1, raw.end, &cp)) return fail("bad \\u escape");
+                    p += 4;
+                    uint32_t low = 0;
+                    if (cp >= 0xD800 && cp < 0xDC00 && raw.end - p >= 7 && p[1] == '\\' && p[2] == 'u' &&
+                        Hex4(p + 3, raw.end, &low) && low >= 0xDC00 && low < 0xE000) {
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                        p += 6;
+                    }
+                    AppendUtf8(*out, cp);
+                    break;
+                }
+                default: return fail("bad escape");
+            }
+        }
+        return true;
+    }
+
+    bool parseNumber(double* value) {
+        skipWs();
+        const char* p = c_.p;
+        const bool negative = p < c_.end && *p == '-';
+        if (negative) ++p;
+        if (p >= c_.end || !IsDigit(*p)) return fail("expected a number");
+
+        double mantissa = 0.0;
+        int exponent = 0;
+        while (p < c_.end && IsDigit(*p)) mantissa = mantissa * 10.0 + (*p++ - '0');
+        if (p < c_.end && *p == '.') {
+            ++p;
+            while (p < c_.end && IsDigit(*p)) {
+                mantissa = mantissa * 10.0 + (*p++ - '0');
+                --exponent;
+            }
+        }
+        if (p < c_.end && (*p == 'e' || *p == 'E')) {
+            ++p;
+            const bool negativeExp = p < c_.end && *p == '-';
+            if (p < c_.end && (*p == '-' || *p == '+')) ++p;
+            int e = 0;
+            while (p < c_.end && IsDigit(*p)) e = std::min(e * 10 + (*p++ - '0'), 9999);
+            exponent += negativeExp ? -e : e;
+        }
+        c_.p = p;
+        *value = (negative ? -mantissa : mantissa) * std::pow(10.0, exponent);
+        return true;
+    }
+
+    bool skipLiteral(const char* literal) {
+        const size_t n = std::strlen(literal);
+        if (static_cast<size_t>(c_.end - c_.p) < n || std::memcmp(c_.p, literal, n) != 0) {
+            return fail("malformed JSON");
+        }
+        c_.p += n;
+        return true;
+    }
+
+    bool skipValue(int depth) {
+        if (depth > kMaxDepth) return fail("JSON nested too deeply");
+        skipWs();
+        switch (c_.peek()) {
+            case '{': return parseObject([&](const Span&) { return skipValue(depth + 1); });
+            case '[': return parseArray([&] { return skipValue(depth + 1); });
+            case '"': {
+                Span raw{};
+                bool escaped = false;
+                return scanString(&raw, &escaped);
+            }
+            case 't': return skipLiteral("true");
+            case 'f': return skipLiteral("false");
+            case 'n': return skipLiteral("null");
+            default: {
+                double ignored = 0.0;
+                return parseNumber(&ignored);
+            }
+        }
+    }
+
+    // Calls member(key) with the cursor on each value.
+    template <typename Fn>
+    bool parseObject(Fn&& member) {
+        if (!expect('{')) return false;
+        skipWs();
+        if (c_.peek() == '}') {
+            ++c_.p;
+            return true;
+        }
+        for (;;) {
+            Span key{};
+            bool escaped = false;
+            if (!scanString(&key, &escaped) || !expect(':') || !member(key)) return false;
+            skipWs();
+            if (c_.peek() == ',') {
+                ++c_.p;
+                continue;
+            }
+            return expect('}');
+        }
+    }
+
+    // Calls element() with the cursor on each element.
+    template <typename Fn>
+    bool parseArray(Fn&& element) {
+        if (!expect('[')) return false;
+        skipWs();
+        if (c_.peek() == ']') {
+            ++c_.p;
+            return true;
+        }
+        for (;;) {
+            if (!element()) return false;
+            skipWs();
+            if (c_.peek() == ',') {
+                ++c_.p;
+                continue;
+            }
+            return expect(']');
+        }
+    }
+
+    bool parseChapters() {
+        skipWs();
+        if (c_.peek() != '[') return fail("\"chapters\" must be an array");
+        return parseArray([&] { return parseChapter(); });
+    }
+
+    bool parseChapter() {
+        skipWs();
+        if (c_.peek() != '{') return fail("chapter must be an object");
+        const size_t line = c_.line;
+
+        MediaTimeUs start = 0;
+        bool hasStart = false;
+        std::string title;
+        const bool parsed = parseObject([&](const Span& key) {
+            const bool seconds = key.equals("start") || key.equals("startTime") || key.equals("start_time") ||
+                                 key.equals("time");
+            const bool millis = key.equals("startMs") || key.equals("start_ms");
+            if (seconds || millis) {
+                if (!parseTime(&start)) return false;
+                if (millis) start = (start + 500) / 1000;
+                hasStart = true;
+                return true;
+            }
+            if (key.equals("title") || key.equals("name")) {
+                Span raw{};
+                bool escaped = false;
+                if (!scanString(&raw, &escaped)) return false;
+                if (!escaped) {
+                    title.assign(raw.begin, raw.end);
+                    return true;
+                }
+                title.clear();
+                return decodeString(raw, &title);
+            }
+            return skipValue(1);
+        });
+        if (!parsed) return false;
+
+        if (!hasStart) {
+            failure_ = {"chapter without a start time", line};
+            return false;
+        }
+        if (const char* error = emit_.add(start, std::move(title))) {
+            failure_ = {error, line};
+            return false;
+        }
+        return true;
+    }
+
+    // A number of seconds, or a string holding one or a clock time
+    bool parseTime(MediaTimeUs* time) {
+        skipWs();
+        if (c_.peek() != '"') {
+            double seconds = 0.0;
+            if (!parseNumber(&seconds)) return false;
+            if (seconds < 0.0) return fail("negative start time");
+            if (!(seconds < kMaxSeconds)) return fail("start time out of range");
+            *time = media_time::fromSeconds(seconds);
+            return true;
+        }
+        Span raw{};
+        bool escaped = false;
+        if (!scanString(&raw, &escaped)) return false;
+        const Span text = Trim(raw);
+        const char* p = text.begin;
+        if (!ParseClock(p, text.end, false, time) || p != text.end) return fail("bad start time");
+        return true;
+    }
+
+    // Beyond any clock time ParseClock accepts, and still fits MediaTimeUs
+    static constexpr double kMaxSeconds = 4e12;
+
+    Cursor& c_;
+    Emitter& emit_;
+    Failure failure_;
+};
+
+bool IsSpace(char c) { return IsBlank(c) || c == '\r' || c == '\n'; }
+
+// JSON starts with '{', or with '[' whose first element is an object (or
+// that is empty); "[12:34] Outro" is a description line.
+ChapterFormat Detect(const Cursor& c) {
+    if (Span{c.p, c.end}.startsWith("WEBVTT")) return ChapterFormat::WebVTT;
+    const char* p = c.p;
+    while (p < c.end && IsSpace(*p)) ++p;
+    if (p < c.end && *p == '{') return ChapterFormat::Json;
+    if (p < c.end && *p == '[') {
+        ++p;
+        while (p < c.end && IsSpace(*p)) ++p;
+        if (p < c.end && (*p == '{' || *p == ']')) return ChapterFormat::Json;
+    }
+    return ChapterFormat::Description;
+}
+
+} // namespace
+
+// =============================================================================
+// ImportChapters
+// =============================================================================
+
+ChapterImportResult ImportChapters(const char* data, size_t size, std::vector<Chapter>& out,
+                                   ChapterFormat format) {
+    ChapterImportResult result;
+    if (!data) size = 0;
+
+    Cursor c{data, data + size};
+    if (size >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0) c.p += 3;  // UTF-8 BOM
+
+    result.format = format == ChapterFormat::Auto ? Detect(c) : format;
+    Emitter emit(out);
+
+    Failure failure;
+    switch (result.format) {
+        case ChapterFormat::WebVTT: failure = ParseWebVTT(c, emit); break;
+        case ChapterFormat::Json: failure = JsonParser(c, emit).parse(); break;
+        case ChapterFormat::Description:
+        case ChapterFormat::Auto: failure = ParseDescription(c, emit); break;
+    }
+
+    if (failure.error) {
+        emit.rollback();
+        result.error = failure.error;
+        result.errorLine = failure.line;
+        return result;
+    }
+    result.ok = true;
+    result.chapters = emit.added();
+    return result;
+}
+
+} // namespace skplayer_ui
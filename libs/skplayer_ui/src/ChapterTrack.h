@@ -0,0 +1,97 @@
+// libs/skplayer_ui/src/ChapterTrack.h
+#pragma once
+
+#include "skplayer_ui/MediaTime.h"
+#include "skplayer_ui/VideoContainer.h"  // for Chapter
+#include "RingBuffer.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace skplayer_ui {
+
+// The container's chapter list, sorted by start time.
+//
+// VOD lists are assigned once. Live streams append at the live edge and
+// expire from the back as the seekable window slides, both O(1). Every
+// chapter gets a sequence number (its index counted from the first chapter
+// ever held), so cached geometry can tell what was appended or expired
+// since it was built; epoch() changes only when the whole list is replaced.
+//
+// Start times are kept as MediaTimeUs alongside (Chapter::startUs when set,
+// else startTime converted on the way in), so lookups compare integers.
+class ChapterTrack {
+public:
+    void assign(std::vector<Chapter> chapters) {
+        std::vector<MediaTimeUs> starts(chapters.size());
+        for (size_t i = 0; i < chapters.size(); ++i) starts[i] = startOf(chapters[i]);
+        ring_ = RingBuffer<Chapter>(std::move(chapters));
+        starts_ = RingBuffer<MediaTimeUs>(std::move(starts));
+        firstSeq_ = 0;
+        ++epoch_;
+    }
+
+    // As above with the start times already converted (and sorted), e.g.
+    // from a snapshot.
+    void assign(std::vector<Chapter> chapters, std::vector<MediaTimeUs> starts) {
+        ring_ = RingBuffer<Chapter>(std::move(chapters));
+        starts_ = RingBuffer<MediaTimeUs>(std::move(starts));
+        firstSeq_ = 0;
+        ++epoch_;
+    }
+
+    // False (and nothing added) unless it starts after the current last one.
+    bool append(Chapter chapter) {
+        const MediaTimeUs start = startOf(chapter);
+        if (!starts_.empty() && start <= starts_.back()) return false;
+        ring_.push_back(std::move(chapter));
+        starts_.push_back(start);
+        return true;
+    }
+
+    // Drops chapters that ended at or before `t`, i.e. whose successor starts
+    // by then. The chapter covering `t` stays: it is the window's first
+    // segment. Returns how many were dropped.
+    size_t expireBefore(MediaTimeUs t) {
+        size_t dropped = 0;
+        while (starts_.size() >= 2 && starts_[1] <= t) {
+            ring_.pop_front();
+            starts_.pop_front();
+            ++firstSeq_;
+            ++dropped;
+        }
+        return dropped;
+    }
+
+    [[nodiscard]] size_t size() const { return ring_.size(); }
+    [[nodiscard]] bool empty() const { return ring_.empty(); }
+    const Chapter& operator[](size_t i) const { return ring_[i]; }
+    [[nodiscard]] MediaTimeUs startUs(size_t i) const { return starts_[i]; }
+
+    // Index of the last chapter starting at or before `t`, or -1 if none does.
+    [[nodiscard]] int indexAt(MediaTimeUs t) const {
+        size_t lo = 0, hi = starts_.size();  // First start > t lies in [lo, hi]
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+            if (starts_[mid] <= t) lo = mid + 1;
+            else hi = mid;
+        }
+        return static_cast<int>(lo) - 1;
+    }
+
+    [[nodiscard]] uint64_t firstSeq() const { return firstSeq_; }
+    [[nodiscard]] uint64_t epoch() const { return epoch_; }
+
+private:
+    static MediaTimeUs startOf(const Chapter& chapter) {
+        return chapter.startUs >= 0 ? chapter.startUs : media_time::fromSeconds(chapter.startTime);
+    }
+
+    RingBuffer<Chapter> ring_;
+    RingBuffer<MediaTimeUs> starts_;
+    uint64_t firstSeq_ = 0;
+    uint64_t epoch_ = 0;
+};
+
+} // namespace skplayer_ui
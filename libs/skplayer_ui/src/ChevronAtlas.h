@@ -0,0 +1,86 @@
+// libs/skplayer_ui/src/ChevronAtlas.h
+#pragma once
+
+#include "SeekBarState.h"  // SeekDirection
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkPathBuilder.h"
+#include "include/core/SkRect.h"
+#include "include/core/SkSurface.h"
+
+#include <cmath>
+
+namespace skplayer_ui {
+
+// Stroked seek chevrons (forward + backward) pre-rasterized white into one
+// small image, so every chevron on screen is a sprite in a single drawAtlas.
+//
+// Sprite origin: the glyph's left edge sits `anchorX` into the cell and its
+// vertical center at `anchorY`, i.e. a chevron at (x, centerY) is drawn with
+// translate (x - anchorX, centerY - anchorY).
+struct ChevronAtlas {
+    sk_sp<SkImage> image;
+    SkRect forward = SkRect::MakeEmpty();
+    SkRect backward = SkRect::MakeEmpty();
+    float anchorX = 0.0f;
+    float anchorY = 0.0f;
+
+    const SkRect& sprite(SeekDirection dir) const {
+        return dir == SeekDirection::Forward ? forward : backward;
+    }
+
+    static ChevronAtlas Make(float width, float height, float strokeWidth) {
+        // Round caps/joins reach half a stroke past the path; +1 px for AA
+        const float pad = std::ceil(strokeWidth * 0.5f) + 1.0f;
+        const int cellW = static_cast<int>(std::ceil(width + pad * 2));
+        const int cellH = static_cast<int>(std::ceil(height + pad * 2));
+
+        ChevronAtlas atlas;
+        atlas.anchorX = pad;
+        atlas.anchorY = cellH * 0.5f;
+        // 1 px transparent gutter between cells so linear sampling never bleeds
+        atlas.forward = SkRect::MakeXYWH(0, 0, cellW, cellH);
+        atlas.backward = SkRect::MakeXYWH(cellW + 1, 0, cellW, cellH);
+
+        sk_sp<SkSurface> surface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(cellW * 2 + 1, cellH));
+        if (!surface) return atlas;
+
+        SkPaint paint;
+        paint.setAntiAlias(true);
+        paint.setColor(SK_ColorWHITE);
+        paint.setStyle(SkPaint::kStroke_Style);
+        paint.setStrokeWidth(strokeWidth);
+        paint.setStrokeCap(SkPaint::kRound_Cap);
+        paint.setStrokeJoin(SkPaint::kRound_Join);
+
+        const float top = atlas.anchorY - height * 0.5f;
+        const float bottom = atlas.anchorY + height * 0.5f;
+
+        SkCanvas* canvas = surface->getCanvas();
+        canvas->clear(SK_ColorTRANSPARENT);
+
+        float x = atlas.forward.left() + pad;
+        canvas->drawPath(SkPathBuilder()
+                             .moveTo(x, top)
+                             .lineTo(x + width, atlas.anchorY)
+                             .lineTo(x, bottom)
+                             .detach(),
+                         paint);
+
+        x = atlas.backward.left() + pad;
+        canvas->drawPath(SkPathBuilder()
+                             .moveTo(x + width, top)
+                             .lineTo(x, atlas.anchorY)
+                             .lineTo(x + width, bottom)
+                             .detach(),
+                         paint);
+
+        atlas.image = surface->makeImageSnapshot();
+        return atlas;
+    }
+};
+
+} // namespace skplayer_ui
@@ -0,0 +1,138 @@
+// libs/skplayer_ui/src/ContainerLayout.h
+#pragma once
+
+#include "DpiResources.h"
+
+#include "include/core/SkRect.h"
+
+#include <array>
+#include <cstdint>
+
+namespace skplayer_ui {
+
+// =============================================================================
+// SeekBar geometry
+// =============================================================================
+
+struct SeekBarGeometry {
+    SkRect bounds = SkRect::MakeEmpty();     // Track extent (landscape side margins applied)
+    SkRect touchArea = SkRect::MakeEmpty();  // bounds + touch extension above
+    float trackY = 0.0f;
+    float trackHeight = 0.0f;
+
+    float thumbY() const { return trackY + trackHeight / 2.0f; }
+};
+
+// =============================================================================
+// Hit-test map
+// =============================================================================
+
+enum class HitRegion : uint8_t { None, SeekBar, PlayPause, Video };
+
+// Fixed, z-ordered (topmost first) table of input regions. Rectangles are
+// inclusive on all edges, matching the original per-component checks.
+class HitMap {
+public:
+    static constexpr uint32_t Bit(HitRegion r) { return 1u << static_cast<uint32_t>(r); }
+    static constexpr uint32_t kAll = ~0u;
+
+    void clear() { count_ = 0; }
+
+    void push(HitRegion region, const SkRect& rect) {
+        if (count_ < kCapacity && !rect.isEmpty()) entries_[count_++] = {rect, region};
+    }
+
+    // Topmost region containing (x, y) among those enabled in `enabled`
+    HitRegion hit(float x, float y, uint32_t enabled = kAll) const {
+        for (int i = 0; i < count_; ++i) {
+            const Entry& e = entries_[i];
+            if (!(enabled & Bit(e.region))) continue;
+            if (x >= e.rect.left() && x <= e.rect.right() &&
+                y >= e.rect.top() && y <= e.rect.bottom()) {
+                return e.region;
+            }
+        }
+        return HitRegion::None;
+    }
+
+private:
+    struct Entry {
+        SkRect rect;
+        HitRegion region;
+    };
+
+    static constexpr int kCapacity = 4;
+    std::array<Entry, kCapacity> entries_{};
+    int count_ = 0;
+};
+
+// =============================================================================
+// Container layout
+// =============================================================================
+//
+// Everything positional about a VideoContainer, computed once per viewport,
+// orientation or DPI change. Render and input only read it.
+
+struct ContainerLayout {
+    SkRect seekBarStrip = SkRect::MakeEmpty();  // Full-width seek bar area
+    SeekBarGeometry seekBar;
+
+    float badgeLeft = 0.0f;       // Time badge top-left
+    float badgeTop = 0.0f;
+    float tooltipCenterX = 0.0f;  // Seek preview tooltip anchor
+    float tooltipY = 0.0f;
+
+    SkRect playPauseButton = SkRect::MakeEmpty();
+    SkRect content = SkRect::MakeEmpty();  // Area that accepts input at all
+
+    HitMap hits;
+
+    static ContainerLayout Compute(const ThemeMetrics& m, float width, float height,
+                                   bool portrait, float videoCenterY) {
+        ContainerLayout l;
+        if (width <= 0.0f || height <= 0.0f) return l;
+
+        // SeekBar: top of the container in portrait, bottom edge in landscape
+        const float stripHeight = m.seekBar.height;
+        l.seekBarStrip = portrait
+            ? SkRect::MakeXYWH(0, 0, width, stripHeight)
+            : SkRect::MakeXYWH(0, height - stripHeight, width, stripHeight);
+
+        const float margin = portrait ? 0.0f : m.seekBar.landscapeMargin;
+        SeekBarGeometry& sb = l.seekBar;
+        sb.bounds = SkRect::MakeXYWH(l.seekBarStrip.left() + margin, l.seekBarStrip.top(),
+                                     l.seekBarStrip.width() - margin * 2, l.seekBarStrip.height());
+        sb.trackHeight = portrait ? m.seekBar.trackHeightPortrait : m.seekBar.trackHeightLandscape;
+        sb.trackY = portrait ? sb.bounds.top() : sb.bounds.centerY() - sb.trackHeight / 2.0f;
+        sb.touchArea = SkRect::MakeLTRB(sb.bounds.left(), sb.bounds.top() - m.seekBar.touchExtensionAbove,
+                                        sb.bounds.right(), sb.bounds.bottom());
+
+        // Badge and tooltip sit above the track
+        const float trackTopY = sb.trackY;
+        l.badgeLeft = l.seekBarStrip.left() + margin + m.timeBadge.marginLeft;
+        l.badgeTop = trackTopY - m.timeBadge.marginAboveSeekBar -
+                     (m.timeBadge.fontSize + m.timeBadge.paddingV * 2);
+        l.tooltipCenterX = width / 2.0f;
+        l.tooltipY = trackTopY - m.tooltip.marginAboveSeekBar -
+                     (m.tooltip.fontSize + m.tooltip.paddingV);
+
+        // Play/pause centered on the video
+        const float buttonSize = m.playPause.buttonSize;
+        l.playPauseButton = SkRect::MakeXYWH((width - buttonSize) / 2.0f,
+                                             videoCenterY - buttonSize / 2.0f,
+                                             buttonSize, buttonSize);
+
+        // Portrait: the container sits below the video; input is accepted
+        // from the video's top edge down. Landscape: everything.
+        l.content = portrait
+            ? SkRect::MakeLTRB(0, 2.0f * videoCenterY, width, height)
+            : SkRect::MakeWH(width, height);
+
+        l.hits.push(HitRegion::SeekBar, sb.touchArea);
+        l.hits.push(HitRegion::PlayPause, l.playPauseButton);
+        l.hits.push(HitRegion::Video, l.content);
+        return l;
+    }
+};
+
+} // namespace skplayer_ui
@@ -0,0 +1,80 @@
+// libs/skplayer_ui/src/CueTrack.h
+#pragma once
+
+#include "skplayer_ui/MediaTime.h"
+#include "skplayer_ui/VideoContainer.h"  // for CuePoint
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace skplayer_ui {
+
+// Cue points sorted by time, plus a playback cursor: the first cue not yet
+// crossed. Playback only moves the cursor forward, so detecting crossings
+// costs one comparison per frame plus one step per cue fired; seeks place
+// it with a binary search. Times are kept as MediaTimeUs next to the cues
+// (CuePoint::timeUs when set, else the float time converted).
+class CueTrack {
+public:
+    // Sorts (stably, so cues sharing a time fire in the given order) and
+    // places the cursor at `position`.
+    void assign(std::vector<CuePoint> cues, MediaTimeUs position) {
+        std::stable_sort(cues.begin(), cues.end(),
+                         [](const CuePoint& a, const CuePoint& b) { return timeOf(a) < timeOf(b); });
+        times_.resize(cues.size());
+        for (size_t i = 0; i < cues.size(); ++i) times_[i] = timeOf(cues[i]);
+        cues_ = std::move(cues);
+        ++epoch_;
+        seek(position);
+    }
+
+    // Already sorted, with times converted, e.g. from a snapshot.
+    void assign(std::vector<CuePoint> cues, std::vector<MediaTimeUs> times, MediaTimeUs position) {
+        cues_ = std::move(cues);
+        times_ = std::move(times);
+        ++epoch_;
+        seek(position);
+    }
+
+    // Position jumped (seek, drag, restart): cues at or after it are ahead.
+    void seek(MediaTimeUs position) { cursor_ = lowerBound(position); }
+
+    // Playback advanced to `position`: fire(cue) for each cue reached, in
+    // order. The cue is passed by copy so fire() may replace the list.
+    template <typename Fn>
+    void advanceTo(MediaTimeUs position, Fn&& fire) {
+        while (cursor_ < times_.size() && times_[cursor_] <= position) {
+            const CuePoint cue = cues_[cursor_++];
+            fire(cue);
+        }
+    }
+
+    [[nodiscard]] size_t size() const { return cues_.size(); }
+    [[nodiscard]] bool empty() const { return cues_.empty(); }
+    const CuePoint& operator[](size_t i) const { return cues_[i]; }
+    [[nodiscard]] MediaTimeUs timeUs(size_t i) const { return times_[i]; }
+
+    // Index of the first cue at or after / after `t`
+    [[nodiscard]] size_t lowerBound(MediaTimeUs t) const {
+        return static_cast<size_t>(std::lower_bound(times_.begin(), times_.end(), t) - times_.begin());
+    }
+    [[nodiscard]] size_t upperBound(MediaTimeUs t) const {
+        return static_cast<size_t>(std::upper_bound(times_.begin(), times_.end(), t) - times_.begin());
+    }
+
+    [[nodiscard]] uint64_t epoch() const { return epoch_; }
+
+private:
+    static MediaTimeUs timeOf(const CuePoint& cue) {
+        return cue.timeUs >= 0 ? cue.timeUs : media_time::fromSeconds(cue.time);
+    }
+
+    std::vector<CuePoint> cues_;
+    std::vector<MediaTimeUs> times_;
+    size_t cursor_ = 0;
+    uint64_t epoch_ = 0;
+};
+
+} // namespace skplayer_ui
@@ -0,0 +1,195 @@
+// libs/skplayer_ui/src/DpiResources.h
+#pragma once
+
+#include "ChevronAtlas.h"
+#include "PlayPauseIcons.h"
+#include "TextBlobCache.h"
+#include "Theme.h"
+
+#include "include/core/SkFont.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkPath.h"
+#include "include/core/SkTypeface.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace skplayer_ui {
+
+// Theme dp constants resolved to pixels for one DPI scale.
+// Mirrors the namespaces in Theme.h / ThemeConstants.h.
+struct ThemeMetrics {
+    struct SeekBar {
+        float height;
+        float trackHeightPortrait;
+        float trackHeightLandscape;
+        float thumbRadius;
+        float thumbTouchRadius;
+        float thumbOffset;           // Thumb center sits slightly left of the progress end
+        float touchExtensionAbove;
+        float dragThreshold;
+        float chapterGap;
+        float cueMarkerWidth;
+        float landscapeMargin;
+        float loadingSegmentMinWidth;
+    } seekBar;
+
+    struct PlayPause {
+        float buttonSize;
+        float iconSize;
+    } playPause;
+
+    struct Tooltip {
+        float fontSize;
+        float paddingH;
+        float paddingV;
+        float marginAboveSeekBar;
+    } tooltip;
+
+    struct TimeBadge {
+        float fontSize;
+        float paddingH;
+        float paddingV;
+        float marginLeft;
+        float marginAboveSeekBar;
+    } timeBadge;
+
+    struct Overlay {
+        float fontSize;
+        float edgeMarginPortrait;
+        float edgeMarginLandscape;
+        float chevronEdgeMarginLandscape;
+        float chevronGap;
+    } overlay;
+
+    struct Chevron {
+        float height;
+        float width;
+        float strokeWidth;
+        float travel;
+    } chevron;
+
+    float doubleTapDistance;
+
+    static ThemeMetrics Resolve(float dpi) {
+        ThemeMetrics m{};
+
+        m.seekBar.height = theme::layout::kSeekBarHeightDp * dpi;
+        m.seekBar.trackHeightPortrait = theme::seekbar::kTrackHeightPortraitDp * dpi;
+        m.seekBar.trackHeightLandscape = theme::seekbar::kTrackHeightLandscapeDp * dpi;
+        m.seekBar.thumbRadius = theme::seekbar::kThumbRadiusDp * dpi;
+        m.seekBar.thumbTouchRadius = theme::seekbar::kThumbTouchTargetDp / 2.0f * dpi;
+        m.seekBar.thumbOffset = 2.0f * dpi;
+        m.seekBar.touchExtensionAbove = theme::seekbar::kTouchExtensionAboveDp * dpi;
+        m.seekBar.dragThreshold = theme::seekbar::kDragThresholdDp * dpi;
+        m.seekBar.chapterGap = theme::seekbar::kChapterGapDp * dpi;
+        m.seekBar.cueMarkerWidth = theme::seekbar::kCueMarkerWidthDp * dpi;
+        m.seekBar.landscapeMargin = theme::seekbar::kLandscapeMarginDp * dpi;
+        m.seekBar.loadingSegmentMinWidth = 56.0f * dpi;
+
+        m.playPause.buttonSize = theme::layout::kPlayPauseButtonSizeDp * dpi;
+        m.playPause.iconSize = m.playPause.buttonSize * 0.4f;
+
+        m.tooltip.fontSize = theme::tooltip::kFontSizeDp * dpi;
+        m.tooltip.paddingH = theme::tooltip::kPaddingHorizontalDp * dpi;
+        m.tooltip.paddingV = theme::tooltip::kPaddingVerticalDp * dpi;
+        m.tooltip.marginAboveSeekBar = theme::tooltip::kMarginAboveSeekBarDp * dpi;
+
+        m.timeBadge.fontSize = theme::timebadge::kFontSizeDp * dpi;
+        m.timeBadge.paddingH = theme::timebadge::kPaddingHorizontalDp * dpi;
+        m.timeBadge.paddingV = theme::timebadge::kPaddingVerticalDp * dpi;
+        m.timeBadge.marginLeft = theme::timebadge::kMarginLeftDp * dpi;
+        m.timeBadge.marginAboveSeekBar = theme::timebadge::kMarginAboveSeekBarDp * dpi;
+
+        m.overlay.fontSize = theme::layout::kOverlayFontSizeDp * dpi;
+        m.overlay.edgeMarginPortrait = theme::layout::kOverlayEdgeMarginDp * dpi;
+        m.overlay.edgeMarginLandscape = theme::layout::kOverlayEdgeMarginLandscapeDp * dpi;
+        m.overlay.chevronEdgeMarginLandscape = theme::layout::kOverlayChevronEdgeMarginLandscapeDp * dpi;
+        m.overlay.chevronGap = theme::layout::kOverlayChevronGapDp * dpi;
+
+        m.chevron.height = theme::chevron::kHeightDp * dpi;
+        m.chevron.width = m.chevron.height * 0.5f;
+        m.chevron.strokeWidth = theme::chevron::kStrokeWidthDp * dpi;
+        m.chevron.travel = theme::chevron::kTravelDistanceDp * dpi;
+
+        m.doubleTapDistance = theme::gesture::kDoubleTapDistanceDp * dpi;
+        return m;
+    }
+};
+
+// Everything derived from (typeface, DPI) that components need at render
+// time. Owned by ResourceContext and shared by every container at that DPI;
+// components keep a `const DpiResources*` instead of their own copies.
+struct DpiResources {
+    DpiResources(float dpi, const sk_sp<SkTypeface>& typeface)
+        : dpiScale(std::max(dpi, 0.01f))
+        , metrics(ThemeMetrics::Resolve(dpiScale))
+        , icons(PlayPauseIcons::Make(metrics.playPause.iconSize))
+        , chevrons(ChevronAtlas::Make(metrics.chevron.width, metrics.chevron.height,
+                                      metrics.chevron.strokeWidth))
+        , tooltipFont(MakeFont(typeface, metrics.tooltip.fontSize, false))
+        , badgeText(MakeFont(typeface, metrics.timeBadge.fontSize, false))
+        , overlayText(MakeFont(typeface, metrics.overlay.fontSize, true))
+        , fixedBytes(ComputeFixedBytes(icons, chevrons)) {}
+
+    DpiResources(const DpiResources&) = delete;
+    DpiResources& operator=(const DpiResources&) = delete;
+
+    const float dpiScale;
+    const ThemeMetrics metrics;
+    const PlayPauseIcons icons;
+    const ChevronAtlas chevrons;
+
+    // Tooltip text is free-form (time + chapter title), so only the font is
+    // shared. Mutable only for setTypeface().
+    mutable SkFont tooltipFont;
+    // Time badge pieces ("1:23", " / 3:14") and seek feedback labels ("+ 10").
+    const TextBlobCache badgeText;
+    const TextBlobCache overlayText;
+
+    // Memory accounting (see ResourceContext / MemoryGovernor). Icons and the
+    // atlas are fixed; only the text caches grow, shrink and purge.
+    const size_t fixedBytes;
+
+    size_t bytesUsed() const { return fixedBytes + badgeText.bytesUsed() + overlayText.bytesUsed(); }
+
+    void setTextByteBudget(size_t bytes) const {
+        badgeText.setByteBudget(bytes / 2);
+        overlayText.setByteBudget(bytes / 2);
+    }
+
+    void purgeText() const {
+        badgeText.clear();
+        overlayText.clear();
+    }
+
+    // Late typeface (see ResourceContext::setTypeface). Metrics, icons and the
+    // atlas don't depend on it, so only fonts and shaped text change.
+    void setTypeface(const sk_sp<SkTypeface>& typeface) const {
+        tooltipFont.setTypeface(typeface);
+        badgeText.setTypeface(typeface);
+        overlayText.setTypeface(typeface);
+    }
+
+private:
+    static size_t ImageBytes(const sk_sp<SkImage>& image) {
+        return image ? image->imageInfo().computeMinByteSize() : 0;
+    }
+
+    static size_t ComputeFixedBytes(const PlayPauseIcons& icons, const ChevronAtlas& chevrons) {
+        size_t bytes = ImageBytes(icons.playImage) + ImageBytes(icons.pauseImage) +
+                       ImageBytes(chevrons.image);
+        for (const SkPath& path : icons.morph) bytes += path.approximateBytesUsed();
+        return bytes;
+    }
+
+    static SkFont MakeFont(const sk_sp<SkTypeface>& typeface, float size, bool embolden) {
+        SkFont font;
+        font.setSize(size);
+        font.setEmbolden(embolden);
+        if (typeface) font.setTypeface(typeface);
+        return font;
+    }
+};
+
+} // namespace skplayer_ui
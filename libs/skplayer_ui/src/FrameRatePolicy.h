@@ -0,0 +1,50 @@
+// libs/skplayer_ui/src/FrameRatePolicy.h
+#pragma once
+
+#include "skplayer_ui/FrameRate.h"
+#include "AnimationScheduler.h"
+
+#include <cstdint>
+
+namespace skplayer_ui {
+
+// Hysteresis over the mode a container's state asks for: faster modes apply
+// at once (a drag must not wait), slower ones only after being asked for
+// continuously for kHoldDownMs, so a tap between bursts or a brief pause
+// doesn't bounce the display's rate.
+class FrameRatePolicy {
+public:
+    static constexpr uint64_t kHoldDownMs = 500;
+
+    // Returns true when the effective mode changed.
+    bool update(FrameRateMode wanted, uint64_t nowMs) {
+        if (wanted >= mode_) {
+            pendingSinceMs_ = kNoDeadline;
+            if (wanted == mode_) return false;
+            mode_ = wanted;
+            return true;
+        }
+        if (pendingSinceMs_ == kNoDeadline || wanted != pending_) {
+            pending_ = wanted;
+            pendingSinceMs_ = nowMs;
+        }
+        if (nowMs - pendingSinceMs_ < kHoldDownMs) return false;
+        mode_ = pending_;
+        pendingSinceMs_ = kNoDeadline;
+        return true;
+    }
+
+    [[nodiscard]] FrameRateMode mode() const { return mode_; }
+
+    // A pending step down needs one more update once it is due
+    void collectDeadlines(DeadlineSet& d) const {
+        if (pendingSinceMs_ != kNoDeadline) d.at(pendingSinceMs_ + kHoldDownMs);
+    }
+
+private:
+    FrameRateMode mode_ = FrameRateMode::Max;  // Until the first update
+    FrameRateMode pending_ = FrameRateMode::Max;
+    uint64_t pendingSinceMs_ = kNoDeadline;
+};
+
+} // namespace skplayer_ui
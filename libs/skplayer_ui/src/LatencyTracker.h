@@ -0,0 +1,117 @@
+// libs/skplayer_ui/src/LatencyTracker.h
+#pragma once
+
+#include "skplayer_ui/InputLatency.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace skplayer_ui {
+
+// =============================================================================
+// Histogram
+// =============================================================================
+
+class LatencyHistogram {
+public:
+    static constexpr int kLinearBuckets = 128;  // 1 ms each
+    static constexpr int kOctaveBuckets = 8;    // 128 ms, 256 ms, ... 16 s and up
+
+    void record(uint64_t ns) {
+        const uint64_t us = ns / 1000;
+        ++count_;
+        sumUs_ += us;
+        maxUs_ = std::max(maxUs_, us);
+        ++buckets_[bucketFor(us / 1000)];
+    }
+
+    void reset() { *this = LatencyHistogram(); }
+
+    LatencySummary summary() const {
+        LatencySummary s;
+        s.count = count_;
+        if (count_ == 0) return s;
+        s.meanMs = static_cast<float>(static_cast<double>(sumUs_) / count_ / 1000.0);
+        s.maxMs = static_cast<float>(maxUs_ / 1000.0);
+        s.p50Ms = percentileMs(0.50);
+        s.p95Ms = percentileMs(0.95);
+        s.p99Ms = percentileMs(0.99);
+        return s;
+    }
+
+private:
+    static int bucketFor(uint64_t ms) {
+        if (ms < kLinearBuckets) return static_cast<int>(ms);
+        int octave = 0;
+        for (uint64_t v = ms / kLinearBuckets; v > 1 && octave < kOctaveBuckets - 1; v >>= 1) ++octave;
+        return kLinearBuckets + octave;
+    }
+
+    // Upper edge of the bucket, capped by the largest sample seen
+    float percentileMs(double p) const {
+        const auto target = static_cast<uint32_t>(std::ceil(p * count_));
+        uint32_t seen = 0;
+        for (int b = 0; b < kLinearBuckets + kOctaveBuckets; ++b) {
+            seen += buckets_[b];
+            if (seen >= target) {
+                const double upper = (b < kLinearBuckets) ? b + 1.0
+                                                          : static_cast<double>(kLinearBuckets << (b - kLinearBuckets + 1));
+                return static_cast<float>(std::min(upper, maxUs_ / 1000.0));
+            }
+        }
+        return static_cast<float>(maxUs_ / 1000.0);
+    }
+
+    std::array<uint32_t, kLinearBuckets + kOctaveBuckets> buckets_{};
+    uint32_t count_ = 0;
+    uint64_t sumUs_ = 0;
+    uint64_t maxUs_ = 0;
+};
+
+// =============================================================================
+// Tracker
+// =============================================================================
+//
+// Follows input timestamps to the screen: note() files an event under its
+// interaction, render() marks what the frame being drawn reflects, and
+// presented() records those at swap time. Several events of one kind before
+// a frame (e.g. drag moves) count once, with the oldest timestamp.
+
+class LatencyTracker {
+public:
+    void note(Interaction kind, uint64_t inputNs) {
+        uint64_t& t = pending_[static_cast<size_t>(kind)];
+        t = (t == 0) ? inputNs : std::min(t, inputNs);
+    }
+
+    void rendered() {
+        for (size_t i = 0; i < kInteractionCount; ++i) {
+            if (pending_[i] == 0) continue;
+            inFlight_[i] = (inFlight_[i] == 0) ? pending_[i] : std::min(inFlight_[i], pending_[i]);
+            pending_[i] = 0;
+        }
+    }
+
+    void presented(uint64_t presentNs) {
+        for (size_t i = 0; i < kInteractionCount; ++i) {
+            if (inFlight_[i] == 0) continue;
+            if (presentNs > inFlight_[i]) histograms_[i].record(presentNs - inFlight_[i]);
+            inFlight_[i] = 0;
+        }
+    }
+
+    LatencySummary summary(Interaction kind) const { return histograms_[static_cast<size_t>(kind)].summary(); }
+
+    void reset() {
+        for (auto& h : histograms_) h.reset();
+    }
+
+private:
+    std::array<uint64_t, kInteractionCount> pending_{};   // 0 = none
+    std::array<uint64_t, kInteractionCount> inFlight_{};
+    std::array<LatencyHistogram, kInteractionCount> histograms_{};
+};
+
+} // namespace skplayer_ui
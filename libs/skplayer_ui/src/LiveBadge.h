@@ -0,0 +1,111 @@
+// libs/skplayer_ui/src/LiveBadge.h
+#pragma once
+
+#include "DpiResources.h"
+#include "TimeFormat.h"
+#include "StatsRecorder.h"
+#include "Theme.h"
+#include "Trace.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkRRect.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <string_view>
+
+namespace skplayer_ui {
+
+// Takes the time badge's place in live mode: "● LIVE" at the live edge, or
+// "● LIVE  -0:42" with a gray dot when playing behind it. Tapping it jumps to
+// live; the container hit-tests against the rect of the last render.
+class LiveBadge {
+public:
+    LiveBadge(const DpiResources& res, StatsRecorder& stats) : res_(&res), stats_(&stats) {}
+
+    void setResources(const DpiResources& res) { res_ = &res; }
+
+    // `behindSeconds` below one second counts as at the edge
+    void update(float behindSeconds) {
+        const int behind = static_cast<int>(std::max(0.0f, behindSeconds));
+        if (behind == cachedBehind_) return;
+        cachedBehind_ = behind;
+        if (behind == 0) {
+            behindView_ = {};
+            return;
+        }
+        std::array<char, 16> text{};
+        auto view = time_format::formatTime(static_cast<float>(behind), text);
+        const int n = std::snprintf(behindText_.data(), behindText_.size(), "  -%.*s",
+                                    static_cast<int>(view.size()), view.data());
+        behindView_ = std::string_view(behindText_.data(),
+            static_cast<size_t>(std::clamp(n, 0, static_cast<int>(behindText_.size()) - 1)));
+    }
+
+    [[nodiscard]] bool isAtEdge() const { return cachedBehind_ <= 0; }
+
+    void render(SkCanvas* canvas, float leftX, float topY, float alpha) {
+        SKPLAYER_TRACE_SCOPE("LiveBadge::render");
+        bounds_ = SkRect::MakeEmpty();
+        if (alpha < 0.01f) return;
+
+        const auto& m = res_->metrics.timeBadge;
+        const float dotRadius = m.fontSize * 0.3f;
+        const float dotGap = m.fontSize * 0.4f;
+
+        uint32_t shaped = 0;
+        const CachedText live = res_->badgeText.get("LIVE", &shaped);
+        const CachedText behind = res_->badgeText.get(behindView_, &shaped);
+        stats_->shapedText(shaped);
+
+        const float badgeW = m.paddingH * 2.0f + dotRadius * 2.0f + dotGap + live.width + behind.width;
+        const float badgeH = m.fontSize + m.paddingV * 2.0f;
+        bounds_ = SkRect::MakeXYWH(leftX, topY, badgeW, badgeH);
+
+        SkPaint bgPaint;
+        bgPaint.setAntiAlias(true);
+        bgPaint.setColor(theme::withAlpha(theme::colors::kBlack,
+                                          static_cast<uint8_t>(theme::timebadge::kBackgroundAlpha * alpha)));
+        canvas->drawRRect(SkRRect::MakeRectXY(bounds_, badgeH / 2.0f, badgeH / 2.0f), bgPaint);
+
+        const auto a = static_cast<uint8_t>(255.0f * alpha);
+        SkPaint dotPaint;
+        dotPaint.setAntiAlias(true);
+        dotPaint.setColor(theme::withAlpha(isAtEdge() ? theme::colors::kProgressVisible : theme::colors::kGray, a));
+        canvas->drawCircle(leftX + m.paddingH + dotRadius, topY + badgeH / 2.0f, dotRadius, dotPaint);
+
+        SkPaint textPaint;
+        textPaint.setAntiAlias(true);
+        textPaint.setColor(theme::withAlpha(theme::colors::kWhite, a));
+        const float textX = leftX + m.paddingH + dotRadius * 2.0f + dotGap;
+        const float textY = topY + m.paddingV + m.fontSize * 0.8f;
+        if (live.blob) canvas->drawTextBlob(live.blob, textX, textY, textPaint);
+        if (behind.blob) {
+            textPaint.setColor(theme::withAlpha(theme::colors::kGray, a));
+            canvas->drawTextBlob(behind.blob, textX + live.width, textY, textPaint);
+        }
+        stats_->draw(Component::LiveBadge, 2 + (live.blob ? 1 : 0) + (behind.blob ? 1 : 0));
+    }
+
+    // Touch target: the last rendered badge grown to the thumb's touch size
+    [[nodiscard]] bool contains(float x, float y) const {
+        if (bounds_.isEmpty()) return false;
+        const float pad = std::max(0.0f, (res_->metrics.seekBar.thumbTouchRadius * 2.0f - bounds_.height()) / 2.0f);
+        return x >= bounds_.left() - pad && x <= bounds_.right() + pad &&
+               y >= bounds_.top() - pad && y <= bounds_.bottom() + pad;
+    }
+
+    void hide() { bounds_ = SkRect::MakeEmpty(); }
+
+private:
+    const DpiResources* res_;
+    StatsRecorder* stats_;
+    int cachedBehind_ = -1;
+    std::array<char, 20> behindText_{};
+    std::string_view behindView_{};
+    SkRect bounds_ = SkRect::MakeEmpty();
+};
+
+} // namespace skplayer_ui
@@ -0,0 +1,184 @@
+#include "skplayer_ui/MemoryGovernor.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace skplayer_ui {
+
+// =============================================================================
+// Config
+// =============================================================================
+
+MemoryGovernor::Config MemoryGovernor::Config::ForSystemRam(uint64_t systemRamMb) {
+    Config config;
+    if (systemRamMb > 0 && systemRamMb <= 2048) {
+        for (size_t& bytes : config.tierBytes) bytes /= 2;
+        config.initialTier = Tier::Reduced;
+    }
+    return config;
+}
+
+// =============================================================================
+// Impl
+// =============================================================================
+
+class MemoryGovernor::Impl {
+public:
+    explicit Impl(const Config& cfg)
+        : config(cfg)
+        , baseTier(cfg.initialTier)
+        , tier(cfg.initialTier) {}
+
+    struct Entry {
+        MemoryCache* cache;
+        float share;
+        int shedOrder;
+        size_t budget = 0;
+    };
+
+    const Config config;
+    Tier baseTier;
+
+    mutable std::mutex mutex;
+    Tier tier;
+    std::vector<Entry> caches;  // Sorted by shed order
+
+    uint64_t lastActiveMs = 0;
+    bool idlePurged = true;  // Nothing to purge before the first frame
+    uint32_t lowMemoryEvents = 0;
+    uint32_t idlePurges = 0;
+
+    size_t tierBudget() const { return config.tierBytes[static_cast<int>(tier)]; }
+
+    size_t totalUsed() const {
+        size_t used = 0;
+        for (const auto& e : caches) used += e.cache->bytesUsed();
+        return used;
+    }
+
+    void applyBudgets() {
+        const size_t total = tierBudget();
+        for (auto& e : caches) {
+            e.budget = static_cast<size_t>(static_cast<double>(total) * e.share);
+            e.cache->setByteBudget(e.budget);
+        }
+    }
+
+    // Purge caches in shed order until usage fits (or everything was purged).
+    void shed() {
+        const size_t budget = tierBudget();
+        for (auto& e : caches) {
+            if (totalUsed() <= budget) return;
+            e.cache->purgeUnlocked();
+        }
+    }
+
+    void purgeAll() {
+        for (auto& e : caches) e.cache->purgeUnlocked();
+    }
+};
+
+// =============================================================================
+// MemoryGovernor public interface
+// =============================================================================
+
+MemoryGovernor::MemoryGovernor() : MemoryGovernor(Config{}) {}
+
+MemoryGovernor::MemoryGovernor(const Config& config)
+    : impl(std::make_unique<Impl>(config)) {}
+
+MemoryGovernor::~MemoryGovernor() = default;
+
+void MemoryGovernor::registerCache(MemoryCache* cache, float share, int shedOrder) {
+    if (!cache) return;
+    std::lock_guard<std::mutex> lock(impl->mutex);
+
+    auto& caches = impl->caches;
+    Impl::Entry entry{cache, std::clamp(share, 0.0f, 1.0f), shedOrder};
+    auto pos = std::upper_bound(caches.begin(), caches.end(), shedOrder,
+        [](int order, const Impl::Entry& e) { return order < e.shedOrder; });
+    auto it = caches.insert(pos, entry);
+
+    it->budget = static_cast<size_t>(static_cast<double>(impl->tierBudget()) * it->share);
+    cache->setByteBudget(it->budget);
+}
+
+void MemoryGovernor::unregisterCache(MemoryCache* cache) {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    auto& caches = impl->caches;
+    caches.erase(std::remove_if(caches.begin(), caches.end(),
+                                [cache](const Impl::Entry& e) { return e.cache == cache; }),
+                 caches.end());
+}
+
+MemoryGovernor::Tier MemoryGovernor::tier() const {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    return impl->tier;
+}
+
+void MemoryGovernor::setTier(Tier tier) {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    impl->baseTier = tier;
+    impl->tier = tier;
+    impl->applyBudgets();
+}
+
+void MemoryGovernor::onLowMemory() {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    ++impl->lowMemoryEvents;
+    if (impl->tier != Tier::Minimal) {
+        impl->tier = static_cast<Tier>(static_cast<int>(impl->tier) + 1);
+    }
+    impl->applyBudgets();
+    impl->shed();
+}
+
+void MemoryGovernor::onEnterBackground() {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    impl->tier = Tier::Minimal;
+    impl->applyBudgets();
+    impl->purgeAll();
+}
+
+void MemoryGovernor::onEnterForeground() {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    impl->tier = impl->baseTier;
+    impl->applyBudgets();
+}
+
+void MemoryGovernor::tick(uint64_t nowMs, bool renderedFrame) {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    if (renderedFrame) {
+        impl->lastActiveMs = nowMs;
+        impl->idlePurged = false;
+        return;
+    }
+    if (!impl->idlePurged && nowMs - impl->lastActiveMs >= impl->config.idlePurgeMs) {
+        impl->purgeAll();
+        impl->idlePurged = true;
+        ++impl->idlePurges;
+    }
+}
+
+bool MemoryGovernor::idlePurgePending() const {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    return !impl->idlePurged;
+}
+
+MemoryGovernor::Stats MemoryGovernor::stats() const {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    Stats s;
+    s.tier = impl->tier;
+    s.budget = impl->tierBudget();
+    s.lowMemoryEvents = impl->lowMemoryEvents;
+    s.idlePurges = impl->idlePurges;
+    s.caches.reserve(impl->caches.size());
+    for (const auto& e : impl->caches) {
+        size_t used = e.cache->bytesUsed();
+        s.bytesUsed += used;
+        s.caches.push_back({e.cache->cacheName(), used, e.budget});
+    }
+    return s;
+}
+
+} // namespace skplayer_ui
@@ -0,0 +1,417 @@
+// libs/skplayer_ui/src/MotionLanes.h
+#pragma once
+
+#include "skplayer_ui/MediaTime.h"
+#include "Theme.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace skplayer_ui {
+
+// =============================================================================
+// Per-container animation state
+// =============================================================================
+//
+// Every continuously animated scalar of a VideoContainer (controls alpha,
+// thumb scale, play/pause morph, ripple, overlay timers, playback position)
+// plus the inputs that drive it. Flags are stored as 0/1 floats so the step
+// kernel below is branch-free and vectorizes over structure-of-arrays lanes.
+// Playback position is the exception: it is integer media time, advanced by
+// integer addition, so hours of frames accumulate no rounding error.
+
+inline constexpr int kMaxParticles = theme::chevron::kMaxParticles;
+
+// Particle ages are clamped at the particle duration, so that age means idle
+inline std::array<float, kMaxParticles> IdleParticles() {
+    std::array<float, kMaxParticles> ages{};
+    ages.fill(theme::chevron::kParticleDurationSeconds);
+    return ages;
+}
+
+struct MotionRow {
+    // SeekBar
+    float controlsAlpha = 1.0f;
+    float controlsTarget = 1.0f;
+    float thumbScale = 1.0f;
+    float thumbTarget = 1.0f;
+    float idleSeconds = 0.0f;       // Time since last interaction (auto-hide)
+    float idleCounting = 0.0f;
+    float loadingPhase = 0.0f;
+    float loadingActive = 0.0f;
+
+    // PlayPauseButton
+    float morph = 1.0f;
+    float morphTarget = 1.0f;
+    float ripple = 1.0f;
+    float rippleActive = 0.0f;
+
+    // SeekFeedbackOverlay + chevrons
+    float feedbackTimer = 0.0f;
+    float feedbackPulse = 0.0f;
+    std::array<float, kMaxParticles> particleAge = IdleParticles();
+
+    // VideoContainer
+    MediaTimeUs position = 0;
+    MediaTimeUs positionRate = 0;   // 1 while playback advances, else 0
+    MediaTimeUs duration = 0;       // Position cap
+    float autoHide = 0.0f;
+    float autoHideActive = 0.0f;
+    float loadingRemaining = 0.0f;
+
+    // Output: 1 if anything visible moved during the last step
+    float changed = 0.0f;
+};
+
+// Pointers into SoA storage. A single MotionRow can be viewed as lanes of
+// length 1, so standalone containers and groups share one kernel.
+struct MotionLanesView {
+    size_t count = 0;
+
+    float* controlsAlpha;
+    float* controlsTarget;
+    float* thumbScale;
+    float* thumbTarget;
+    float* idleSeconds;
+    float* idleCounting;
+    float* loadingPhase;
+    float* loadingActive;
+    float* morph;
+    float* morphTarget;
+    float* ripple;
+    float* rippleActive;
+    float* feedbackTimer;
+    float* feedbackPulse;
+    std::array<float*, kMaxParticles> particleAge;
+    MediaTimeUs* position;
+    MediaTimeUs* positionRate;
+    MediaTimeUs* duration;
+    float* autoHide;
+    float* autoHideActive;
+    float* loadingRemaining;
+    float* changed;
+
+    static MotionLanesView Of(MotionRow& r) {
+        MotionLanesView v{};
+        v.count = 1;
+        v.controlsAlpha = &r.controlsAlpha;
+        v.controlsTarget = &r.controlsTarget;
+        v.thumbScale = &r.thumbScale;
+        v.thumbTarget = &r.thumbTarget;
+        v.idleSeconds = &r.idleSeconds;
+        v.idleCounting = &r.idleCounting;
+        v.loadingPhase = &r.loadingPhase;
+        v.loadingActive = &r.loadingActive;
+        v.morph = &r.morph;
+        v.morphTarget = &r.morphTarget;
+        v.ripple = &r.ripple;
+        v.rippleActive = &r.rippleActive;
+        v.feedbackTimer = &r.feedbackTimer;
+        v.feedbackPulse = &r.feedbackPulse;
+        for (int j = 0; j < kMaxParticles; ++j) v.particleAge[j] = &r.particleAge[j];
+        v.position = &r.position;
+        v.positionRate = &r.positionRate;
+        v.duration = &r.duration;
+        v.autoHide = &r.autoHide;
+        v.autoHideActive = &r.autoHideActive;
+        v.loadingRemaining = &r.loadingRemaining;
+        v.changed = &r.changed;
+        return v;
+    }
+};
+
+// One container's row: index `index` of `lanes`, which are either the
+// container's own single row or its group's lanes. The container and its
+// components read and write their animated values through it; the group
+// re-points it (it doesn't copy the row) when the row moves.
+class MotionRef {
+public:
+    MotionRef(const MotionLanesView* lanes, size_t index) : lanes_(lanes), index_(index) {}
+
+    size_t index() const { return index_; }
+
+    float& controlsAlpha() const { return lanes_->controlsAlpha[index_]; }
+    float& controlsTarget() const { return lanes_->controlsTarget[index_]; }
+    float& thumbScale() const { return lanes_->thumbScale[index_]; }
+    float& thumbTarget() const { return lanes_->thumbTarget[index_]; }
+    float& idleSeconds() const { return lanes_->idleSeconds[index_]; }
+    float& idleCounting() const { return lanes_->idleCounting[index_]; }
+    float& loadingPhase() const { return lanes_->loadingPhase[index_]; }
+    float& loadingActive() const { return lanes_->loadingActive[index_]; }
+    float& morph() const { return lanes_->morph[index_]; }
+    float& morphTarget() const { return lanes_->morphTarget[index_]; }
+    float& ripple() const { return lanes_->ripple[index_]; }
+    float& rippleActive() const { return lanes_->rippleActive[index_]; }
+    float& feedbackTimer() const { return lanes_->feedbackTimer[index_]; }
+    float& feedbackPulse() const { return lanes_->feedbackPulse[index_]; }
+    float& particleAge(int j) const { return lanes_->particleAge[j][index_]; }
+    MediaTimeUs& position() const { return lanes_->position[index_]; }
+    MediaTimeUs& positionRate() const { return lanes_->positionRate[index_]; }
+    MediaTimeUs& duration() const { return lanes_->duration[index_]; }
+    float& autoHide() const { return lanes_->autoHide[index_]; }
+    float& autoHideActive() const { return lanes_->autoHideActive[index_]; }
+    float& loadingRemaining() const { return lanes_->loadingRemaining[index_]; }
+    float& changed() const { return lanes_->changed[index_]; }
+
+    // The row alone, as lanes of length 1 (steps a single container)
+    MotionLanesView row() const {
+        const MotionLanesView& l = *lanes_;
+        const size_t i = index_;
+        MotionLanesView v{};
+        v.count = 1;
+        v.controlsAlpha = l.controlsAlpha + i;
+        v.controlsTarget = l.controlsTarget + i;
+        v.thumbScale = l.thumbScale + i;
+        v.thumbTarget = l.thumbTarget + i;
+        v.idleSeconds = l.idleSeconds + i;
+        v.idleCounting = l.idleCounting + i;
+        v.loadingPhase = l.loadingPhase + i;
+        v.loadingActive = l.loadingActive + i;
+        v.morph = l.morph + i;
+        v.morphTarget = l.morphTarget + i;
+        v.ripple = l.ripple + i;
+        v.rippleActive = l.rippleActive + i;
+        v.feedbackTimer = l.feedbackTimer + i;
+        v.feedbackPulse = l.feedbackPulse + i;
+        for (int j = 0; j < kMaxParticles; ++j) v.particleAge[j] = l.particleAge[j] + i;
+        v.position = l.position + i;
+        v.positionRate = l.positionRate + i;
+        v.duration = l.duration + i;
+        v.autoHide = l.autoHide + i;
+        v.autoHideActive = l.autoHideActive + i;
+        v.loadingRemaining = l.loadingRemaining + i;
+        v.changed = l.changed + i;
+        return v;
+    }
+
+private:
+    const MotionLanesView* lanes_;
+    size_t index_;
+};
+
+// Converts each step's float seconds to whole microseconds for the position
+// lanes, carrying the rounding remainder so the summed steps stay within
+// half a microsecond of the summed dts however long playback runs.
+class StepClock {
+public:
+    MediaTimeUs step(float dt) {
+        const double exact = static_cast<double>(dt) * 1e6 + carry_;
+        const auto us = static_cast<MediaTimeUs>(std::llround(exact));
+        carry_ = exact - static_cast<double>(us);
+        return us;
+    }
+
+private:
+    double carry_ = 0.0;
+};
+
+namespace motion {
+
+// Exponential approach toward `target`, clamped and snapped once within
+// `settle` (see theme::settle). `rate` is capped at 1 so long frames (e.g.
+// after the host slept until a deadline) land exactly on the target.
+inline float approach(float value, float target, float rate, float settle, float lo, float hi) {
+    float next = std::clamp(value + (target - value) * std::min(rate, 1.0f), lo, hi);
+    return (std::abs(target - next) < settle) ? target : next;
+}
+
+// One step for `v.count` containers. Pure arithmetic over contiguous lanes;
+// discrete consequences (state transitions) are applied by the caller
+// afterwards. `dtUs` is `dt` from a StepClock.
+inline void advance(const MotionLanesView& v, float dt, MediaTimeUs dtUs) {
+    using namespace theme;
+    const float fadeInRate = seekbar::kFadeInSpeed * dt;
+    const float fadeOutRate = seekbar::kFadeOutSpeed * dt;
+    const float thumbRate = seekbar::kThumbScaleAnimationSpeed * dt;
+    const float morphRate = playpause::kMorphSpeed * dt;
+    const float rippleStep = dt / playpause::kRippleDurationSeconds;
+    const float phaseStep = dt * seekbar::kLoadingAnimationSpeed;
+    const float particleEnd = chevron::kParticleDurationSeconds;
+    const float feedbackFade = 1.0f / layout::kFeedbackFadeOutSeconds;
+
+    for (size_t i = 0; i < v.count; ++i) {
+        // Auto-hide of the seek bar after a period without interaction
+        float idle = v.idleSeconds[i] + dt * v.idleCounting[i];
+        bool hide = v.idleCounting[i] > 0.0f && idle >= seekbar::kAutoHideDelaySeconds;
+        float target = hide ? 0.0f : v.controlsTarget[i];
+        v.idleSeconds[i] = idle;
+        v.controlsTarget[i] = target;
+
+        float fadeRate = (target < v.controlsAlpha[i]) ? fadeOutRate : fadeInRate;
+        float alpha = approach(v.controlsAlpha[i], target, fadeRate, settle::kAlpha, 0.0f, 1.0f);
+        float thumb = approach(v.thumbScale[i], v.thumbTarget[i], thumbRate, settle::kThumbScale, 1.0f, 1.5f);
+        float morph = approach(v.morph[i], v.morphTarget[i], morphRate, settle::kMorph, 0.0f, 1.0f);
+
+        float phase = v.loadingPhase[i] + phaseStep * v.loadingActive[i];
+        phase -= std::floor(phase);
+
+        float ripple = std::min(v.ripple[i] + rippleStep * v.rippleActive[i], 1.0f);
+        float rippleActive = (ripple < 1.0f) ? v.rippleActive[i] : 0.0f;
+
+        float feedback = std::max(v.feedbackTimer[i] - dt, 0.0f);
+        float pulse = std::max(v.feedbackPulse[i] - dt * 10.0f, 0.0f);
+
+        MediaTimeUs pos = std::min(v.position[i] + dtUs * v.positionRate[i], v.duration[i]);
+
+        // Feedback text is drawn at min(timer / fade-out, 1): static until
+        // the fade starts, so only the fade (and reaching zero) counts
+        float feedbackAlpha = std::min(feedback * feedbackFade, 1.0f);
+        float lastFeedbackAlpha = std::min(v.feedbackTimer[i] * feedbackFade, 1.0f);
+
+        float changed = std::abs(alpha - v.controlsAlpha[i]) + std::abs(thumb - v.thumbScale[i]) +
+                        std::abs(morph - v.morph[i]) + std::abs(ripple - v.ripple[i]) +
+                        std::abs(phase - v.loadingPhase[i]) + std::abs(pulse - v.feedbackPulse[i]) +
+                        std::abs(feedbackAlpha - lastFeedbackAlpha) +
+                        ((pos != v.position[i]) ? 1.0f : 0.0f);
+        for (int j = 0; j < kMaxParticles; ++j) {
+            float age = v.particleAge[j][i];
+            changed += (age < particleEnd) ? 1.0f : 0.0f;
+            v.particleAge[j][i] = std::min(age + dt, particleEnd);
+        }
+
+        v.controlsAlpha[i] = alpha;
+        v.thumbScale[i] = thumb;
+        v.morph[i] = morph;
+        v.loadingPhase[i] = phase;
+        v.ripple[i] = ripple;
+        v.rippleActive[i] = rippleActive;
+        v.feedbackTimer[i] = feedback;
+        v.feedbackPulse[i] = pulse;
+        v.position[i] = pos;
+        v.autoHide[i] = std::max(v.autoHide[i] - dt * v.autoHideActive[i], 0.0f);
+        v.loadingRemaining[i] = std::max(v.loadingRemaining[i] - dt * v.loadingActive[i], 0.0f);
+        v.changed[i] = (changed > 0.0f) ? 1.0f : 0.0f;
+    }
+}
+
+} // namespace motion
+
+// =============================================================================
+// SoA storage for VideoContainerGroup
+// =============================================================================
+//
+// The rows of every container in a group. The lanes own that state for as
+// long as a container is grouped: the container reads and writes its row by
+// index (see MotionRef), and the group keeps the active rows packed at the
+// front so one kernel pass steps exactly those. Waking or retiring a
+// container swaps two rows; nothing is copied per frame.
+
+class MotionLanes {
+public:
+    MotionLanes() = default;
+    MotionLanes(const MotionLanes&) = delete;  // view() points into the lanes
+    MotionLanes& operator=(const MotionLanes&) = delete;
+
+    size_t size() const { return changed_.size(); }
+
+    // Appends `r` as the last row and returns its index
+    size_t push(const MotionRow& r) {
+        const size_t i = size();
+        forEachLane([i](auto& lane) { lane.resize(i + 1); });
+        store(i, r);
+        refreshView();
+        return i;
+    }
+
+    void pop() {
+        forEachLane([](auto& lane) { lane.pop_back(); });
+        refreshView();
+    }
+
+    void swap(size_t a, size_t b) {
+        if (a == b) return;
+        forEachLane([a, b](auto& lane) { std::swap(lane[a], lane[b]); });
+    }
+
+    // All rows. The reference stays valid as rows are added and removed
+    // (MotionRefs point at it); the lanes behind it may move.
+    const MotionLanesView& view() const { return view_; }
+
+    // The first `n` rows, for one kernel pass
+    MotionLanesView view(size_t n) const {
+        MotionLanesView v = view_;
+        v.count = n;
+        return v;
+    }
+
+private:
+    template <typename Fn>
+    void forEachLane(Fn&& fn) {
+        for (auto* lane : {&controlsAlpha_, &controlsTarget_, &thumbScale_, &thumbTarget_, &idleSeconds_,
+                           &idleCounting_, &loadingPhase_, &loadingActive_, &morph_, &morphTarget_, &ripple_,
+                           &rippleActive_, &feedbackTimer_, &feedbackPulse_, &autoHide_, &autoHideActive_,
+                           &loadingRemaining_, &changed_}) {
+            fn(*lane);
+        }
+        for (auto& lane : particleAge_) fn(lane);
+        for (auto* lane : {&position_, &positionRate_, &duration_}) fn(*lane);
+    }
+
+    void store(size_t i, const MotionRow& r) {
+        controlsAlpha_[i] = r.controlsAlpha;
+        controlsTarget_[i] = r.controlsTarget;
+        thumbScale_[i] = r.thumbScale;
+        thumbTarget_[i] = r.thumbTarget;
+        idleSeconds_[i] = r.idleSeconds;
+        idleCounting_[i] = r.idleCounting;
+        loadingPhase_[i] = r.loadingPhase;
+        loadingActive_[i] = r.loadingActive;
+        morph_[i] = r.morph;
+        morphTarget_[i] = r.morphTarget;
+        ripple_[i] = r.ripple;
+        rippleActive_[i] = r.rippleActive;
+        feedbackTimer_[i] = r.feedbackTimer;
+        feedbackPulse_[i] = r.feedbackPulse;
+        for (int j = 0; j < kMaxParticles; ++j) particleAge_[j][i] = r.particleAge[j];
+        position_[i] = r.position;
+        positionRate_[i] = r.positionRate;
+        duration_[i] = r.duration;
+        autoHide_[i] = r.autoHide;
+        autoHideActive_[i] = r.autoHideActive;
+        loadingRemaining_[i] = r.loadingRemaining;
+        changed_[i] = r.changed;
+    }
+
+    void refreshView() {
+        view_.count = size();
+        view_.controlsAlpha = controlsAlpha_.data();
+        view_.controlsTarget = controlsTarget_.data();
+        view_.thumbScale = thumbScale_.data();
+        view_.thumbTarget = thumbTarget_.data();
+        view_.idleSeconds = idleSeconds_.data();
+        view_.idleCounting = idleCounting_.data();
+        view_.loadingPhase = loadingPhase_.data();
+        view_.loadingActive = loadingActive_.data();
+        view_.morph = morph_.data();
+        view_.morphTarget = morphTarget_.data();
+        view_.ripple = ripple_.data();
+        view_.rippleActive = rippleActive_.data();
+        view_.feedbackTimer = feedbackTimer_.data();
+        view_.feedbackPulse = feedbackPulse_.data();
+        for (int j = 0; j < kMaxParticles; ++j) view_.particleAge[j] = particleAge_[j].data();
+        view_.position = position_.data();
+        view_.positionRate = positionRate_.data();
+        view_.duration = duration_.data();
+        view_.autoHide = autoHide_.data();
+        view_.autoHideActive = autoHideActive_.data();
+        view_.loadingRemaining = loadingRemaining_.data();
+        view_.changed = changed_.data();
+    }
+
+    std::vector<float> controlsAlpha_, controlsTarget_, thumbScale_, thumbTarget_;
+    std::vector<float> idleSeconds_, idleCounting_, loadingPhase_, loadingActive_;
+    std::vector<float> morph_, morphTarget_, ripple_, rippleActive_;
+    std::vector<float> feedbackTimer_, feedbackPulse_;
+    std::array<std::vector<float>, kMaxParticles> particleAge_;
+    std::vector<MediaTimeUs> position_, positionRate_, duration_;
+    std::vector<float> autoHide_, autoHideActive_, loadingRemaining_;
+    std::vector<float> changed_;
+    MotionLanesView view_{};
+};
+
+} // namespace skplayer_ui
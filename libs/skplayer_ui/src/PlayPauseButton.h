@@ -1,12 +1,16 @@
 // libs/skplayer_ui/src/PlayPauseButton.h
 #pragma once
 
+#include "DpiResources.h"
+#include "MotionLanes.h"
+#include "StatsRecorder.h"
 #include "Theme.h"
+#include "Trace.h"
 
 #include "include/core/SkCanvas.h"
+#include "include/core/SkImage.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkPath.h"
-#include "include/core/SkPathBuilder.h"
 #include "include/core/SkRect.h"
 
 #include <algorithm>
@@ -15,34 +19,21 @@ namespace skplayer_ui {
 
 class PlayPauseButton {
 public:
-    explicit PlayPauseButton(float dpiScale)
-        : dpiScale_(std::max(dpiScale, 0.01f)) {}
+    // Morph (0=play, 1=pause) and ripple live in the container's `motion` row
+    PlayPauseButton(const DpiResources& res, StatsRecorder& stats, const MotionRef& motion)
+        : res_(&res), stats_(&stats), motion_(&motion) {}
 
-    void setPlaying(bool playing) { isPlaying_ = playing; }
+    void setResources(const DpiResources& res) { res_ = &res; }
 
-    void startRipple() {
-        rippleActive_ = true;
-        rippleT_ = 0.0f;
-    }
+    void setPlaying(bool playing) { motion_->morphTarget() = playing ? 1.0f : 0.0f; }
 
-    void update(float dt) {
-        // Morph animation
-        float targetMorph = isPlaying_ ? 1.0f : 0.0f;
-        float diff = targetMorph - morphProgress_;
-        morphProgress_ += diff * theme::playpause::kMorphSpeed * dt;
-        morphProgress_ = std::clamp(morphProgress_, 0.0f, 1.0f);
-
-        // Ripple animation
-        if (rippleActive_) {
-            rippleT_ += std::max(dt, 0.0f) / theme::playpause::kRippleDurationSeconds;
-            if (rippleT_ >= 1.0f) {
-                rippleT_ = 1.0f;
-                rippleActive_ = false;
-            }
-        }
+    void startRipple() {
+        motion_->rippleActive() = 1.0f;
+        motion_->ripple() = 0.0f;
     }
 
     void render(SkCanvas* canvas, const SkRect& bounds, float alpha) {
+        SKPLAYER_TRACE_SCOPE("PlayPauseButton::render");
         if (alpha < 0.01f) return;
 
         float radius = bounds.width() / 2;
@@ -56,8 +47,9 @@ public:
         canvas->drawCircle(cx, cy, radius, bgPaint);
 
         // Ripple overlay
-        if (rippleActive_) {
-            float rippleAlpha = (1.0f - rippleT_) * alpha;
+        const bool rippleActive = motion_->rippleActive() > 0.5f;
+        if (rippleActive) {
+            float rippleAlpha = (1.0f - motion_->ripple()) * alpha;
             SkPaint ripplePaint;
             ripplePaint.setAntiAlias(true);
             ripplePaint.setColor(theme::withAlpha(theme::colors::kWhite,
@@ -65,91 +57,32 @@ public:
             canvas->drawCircle(cx, cy, radius, ripplePaint);
         }
 
-        // Initialize paths on first render
-        float iconSize = (radius * 0.8f) / dpiScale_;
-        if (!pathsInitialized_) {
-            initializePaths(iconSize);
-        }
-
-        // Morph between play/pause
-        SkPath morphedPath;
-        if (!pausePath_.interpolate(playPath_, morphProgress_, &morphedPath)) {
-            morphedPath = isPlaying_ ? pausePath_ : playPath_;
-        }
-
-        // Draw icon
+        // Icon: cached glyph image at rest, nearest precomputed keyframe while morphing
+        const PlayPauseIcons& icons = res_->icons;
         SkPaint iconPaint;
         iconPaint.setColor(theme::withAlpha(theme::colors::kWhite, static_cast<uint8_t>(255 * alpha)));
         iconPaint.setAntiAlias(true);
         iconPaint.setStyle(SkPaint::kFill_Style);
 
-        canvas->save();
-        canvas->translate(cx, cy);
-        canvas->scale(dpiScale_, dpiScale_);
-        canvas->drawPath(morphedPath, iconPaint);
-        canvas->restore();
+        const float morph = motion_->morph();
+        if (const SkImage* image = icons.restingImage(morph)) {
+            // Unrounded, so the glyph sits exactly where the morph path does
+            // and doesn't shift when the morph starts or ends
+            canvas->drawImage(image, cx - image->width() * 0.5f, cy - image->height() * 0.5f,
+                              SkSamplingOptions(SkFilterMode::kLinear), &iconPaint);
+        } else {
+            canvas->save();
+            canvas->translate(cx, cy);
+            canvas->drawPath(icons.at(morph), iconPaint);
+            canvas->restore();
+        }
+        stats_->draw(Component::PlayPauseButton, rippleActive ? 3 : 2);
     }
 
 private:
-    void initializePaths(float iconSize) {
-        float barWidth = iconSize * 0.28f;
-        float barHeight = iconSize * 0.9f;
-        float barGap = iconSize * 0.15f;
-
-        float leftBarLeft = -barGap / 2 - barWidth;
-        float leftBarRight = -barGap / 2;
-        float rightBarLeft = barGap / 2;
-        float rightBarRight = barGap / 2 + barWidth;
-        float barTop = -barHeight / 2;
-        float barBottom = barHeight / 2;
-
-        // Pause icon (two bars)
-        pausePath_ = SkPathBuilder()
-            .moveTo(leftBarLeft, barTop)
-            .lineTo(leftBarLeft, barBottom)
-            .lineTo(leftBarRight, barBottom)
-            .lineTo(leftBarRight, barTop)
-            .lineTo(rightBarLeft, barTop)
-            .lineTo(rightBarLeft, barBottom)
-            .lineTo(rightBarRight, barBottom)
-            .lineTo(rightBarRight, barTop)
-            .close()
-            .detach();
-
-        // Play icon (triangle with matching vertex count for interpolation)
-        float leftX = leftBarLeft;
-        float triangleHeight = iconSize * 0.9f;
-        float rightX = leftX + triangleHeight;
-        float topY = -triangleHeight / 2;
-        float bottomY = triangleHeight / 2;
-        float midY = 0;
-        float seamT = 0.5f;
-
-        playPath_ = SkPathBuilder()
-            .moveTo(leftX, topY)
-            .lineTo(leftX, bottomY)
-            .lineTo(leftX + (rightX - leftX) * seamT, bottomY + (midY - bottomY) * seamT)
-            .lineTo(leftX + (rightX - leftX) * seamT, topY + (midY - topY) * seamT)
-            .lineTo(leftX + (rightX - leftX) * seamT, topY + (midY - topY) * seamT)
-            .lineTo(leftX + (rightX - leftX) * seamT, bottomY + (midY - bottomY) * seamT)
-            .lineTo(rightX, midY)
-            .lineTo(rightX, midY)
-            .close()
-            .detach();
-
-        pathsInitialized_ = true;
-    }
-
-    float dpiScale_;
-    bool isPlaying_ = true;
-    float morphProgress_ = 1.0f;  // 0=play, 1=pause
-
-    bool rippleActive_ = false;
-    float rippleT_ = 1.0f;
-
-    SkPath playPath_;
-    SkPath pausePath_;
-    bool pathsInitialized_ = false;
+    const DpiResources* res_;
+    StatsRecorder* stats_;
+    const MotionRef* motion_;
 };
 
 } // namespace skplayer_ui
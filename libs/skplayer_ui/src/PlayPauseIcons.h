@@ -0,0 +1,127 @@
+// libs/skplayer_ui/src/PlayPauseIcons.h
+#pragma once
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkPath.h"
+#include "include/core/SkPathBuilder.h"
+#include "include/core/SkSurface.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace skplayer_ui {
+
+// Play/pause glyphs centered on the origin, in pixels. Both paths have the
+// same verb/point layout so `SkPath::interpolate` can morph between them.
+//
+// The morph is baked once per DPI into evenly spaced keyframes, so rendering
+// only picks a path (no per-frame interpolate/allocation), and the two rest
+// states are pre-rasterized white glyphs that draw as a single image.
+struct PlayPauseIcons {
+    // 1/64 steps: vertices jump < 1 px per keyframe even at 3x DPI.
+    static constexpr int kMorphKeyframes = 65;
+
+    SkPath play;
+    SkPath pause;
+    std::array<SkPath, kMorphKeyframes> morph;  // [0] = play ... [N-1] = pause
+
+    sk_sp<SkImage> playImage;
+    sk_sp<SkImage> pauseImage;
+
+    // Keyframe nearest to `t` (0 = play, 1 = pause)
+    const SkPath& at(float t) const {
+        int i = static_cast<int>(std::lround(std::clamp(t, 0.0f, 1.0f) * (kMorphKeyframes - 1)));
+        return morph[i];
+    }
+
+    // Rasterized glyph for a settled morph, else null (draw `at(t)` instead)
+    const SkImage* restingImage(float t) const {
+        if (t <= 0.0f) return playImage.get();
+        if (t >= 1.0f) return pauseImage.get();
+        return nullptr;
+    }
+
+    static PlayPauseIcons Make(float iconSize) {
+        float barWidth = iconSize * 0.28f;
+        float barHeight = iconSize * 0.9f;
+        float barGap = iconSize * 0.15f;
+
+        float leftBarLeft = -barGap / 2 - barWidth;
+        float leftBarRight = -barGap / 2;
+        float rightBarLeft = barGap / 2;
+        float rightBarRight = barGap / 2 + barWidth;
+        float barTop = -barHeight / 2;
+        float barBottom = barHeight / 2;
+
+        PlayPauseIcons icons;
+
+        // Pause icon (two bars)
+        icons.pause = SkPathBuilder()
+            .moveTo(leftBarLeft, barTop)
+            .lineTo(leftBarLeft, barBottom)
+            .lineTo(leftBarRight, barBottom)
+            .lineTo(leftBarRight, barTop)
+            .lineTo(rightBarLeft, barTop)
+            .lineTo(rightBarLeft, barBottom)
+            .lineTo(rightBarRight, barBottom)
+            .lineTo(rightBarRight, barTop)
+            .close()
+            .detach();
+
+        // Play icon (triangle with matching vertex count for interpolation)
+        float leftX = leftBarLeft;
+        float triangleHeight = iconSize * 0.9f;
+        float rightX = leftX + triangleHeight;
+        float topY = -triangleHeight / 2;
+        float bottomY = triangleHeight / 2;
+        float midY = 0;
+        float seamT = 0.5f;
+
+        icons.play = SkPathBuilder()
+            .moveTo(leftX, topY)
+            .lineTo(leftX, bottomY)
+            .lineTo(leftX + (rightX - leftX) * seamT, bottomY + (midY - bottomY) * seamT)
+            .lineTo(leftX + (rightX - leftX) * seamT, topY + (midY - topY) * seamT)
+            .lineTo(leftX + (rightX - leftX) * seamT, topY + (midY - topY) * seamT)
+            .lineTo(leftX + (rightX - leftX) * seamT, bottomY + (midY - bottomY) * seamT)
+            .lineTo(rightX, midY)
+            .lineTo(rightX, midY)
+            .close()
+            .detach();
+
+        for (int i = 0; i < kMorphKeyframes; ++i) {
+            float t = static_cast<float>(i) / (kMorphKeyframes - 1);
+            if (!icons.pause.interpolate(icons.play, t, &icons.morph[i])) {
+                icons.morph[i] = (t < 0.5f) ? icons.play : icons.pause;
+            }
+        }
+
+        icons.playImage = Rasterize(icons.play, iconSize);
+        icons.pauseImage = Rasterize(icons.pause, iconSize);
+        return icons;
+    }
+
+private:
+    // White glyph centered in a square image; 1 px margin for antialiasing.
+    static sk_sp<SkImage> Rasterize(const SkPath& path, float iconSize) {
+        const int side = static_cast<int>(std::ceil(iconSize)) + 2;
+        sk_sp<SkSurface> surface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(side, side));
+        if (!surface) return nullptr;
+
+        SkPaint paint;
+        paint.setAntiAlias(true);
+        paint.setColor(SK_ColorWHITE);
+
+        SkCanvas* canvas = surface->getCanvas();
+        canvas->clear(SK_ColorTRANSPARENT);
+        canvas->translate(side * 0.5f, side * 0.5f);
+        canvas->drawPath(path, paint);
+        return surface->makeImageSnapshot();
+    }
+};
+
+} // namespace skplayer_ui
@@ -0,0 +1,87 @@
+#include "skplayer_ui/ResourceContext.h"
+#include "DpiResources.h"
+
+#include "include/core/SkTypeface.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace skplayer_ui {
+
+class ResourceContext::Impl {
+public:
+    explicit Impl(SkTypeface* tf) : typeface(sk_ref_sp(tf)) {}
+
+    sk_sp<SkTypeface> typeface;
+
+    mutable std::mutex mutex;
+    // unique_ptr keeps entries address-stable; a handful of DPIs at most.
+    std::vector<std::unique_ptr<DpiResources>> perDpi;
+    size_t byteBudget = SIZE_MAX;
+
+    // Text budget per DPI: whatever the fixed resources leave, split evenly.
+    void applyBudget() {
+        if (perDpi.empty()) return;
+        size_t text = SIZE_MAX;
+        if (byteBudget != SIZE_MAX) {
+            size_t fixed = 0;
+            for (const auto& res : perDpi) fixed += res->fixedBytes;
+            text = (byteBudget > fixed) ? (byteBudget - fixed) / perDpi.size() : 0;
+        }
+        for (const auto& res : perDpi) res->setTextByteBudget(text);
+    }
+};
+
+std::shared_ptr<ResourceContext> ResourceContext::Make(SkTypeface* typeface) {
+    return std::shared_ptr<ResourceContext>(new ResourceContext(typeface));
+}
+
+ResourceContext::ResourceContext(SkTypeface* typeface)
+    : impl(std::make_unique<Impl>(typeface)) {}
+
+ResourceContext::~ResourceContext() = default;
+
+SkTypeface* ResourceContext::typeface() const {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    return impl->typeface.get();
+}
+
+void ResourceContext::setTypeface(SkTypeface* typeface) {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    impl->typeface = sk_ref_sp(typeface);
+    for (const auto& res : impl->perDpi) res->setTypeface(impl->typeface);
+}
+
+const DpiResources& ResourceContext::forDpi(float dpiScale) {
+    const float dpi = std::max(dpiScale, 0.01f);
+
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    for (const auto& res : impl->perDpi) {
+        if (res->dpiScale == dpi) return *res;
+    }
+    impl->perDpi.push_back(std::make_unique<DpiResources>(dpi, impl->typeface));
+    impl->applyBudget();
+    return *impl->perDpi.back();
+}
+
+size_t ResourceContext::bytesUsed() const {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    size_t bytes = 0;
+    for (const auto& res : impl->perDpi) bytes += res->bytesUsed();
+    return bytes;
+}
+
+void ResourceContext::setByteBudget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    impl->byteBudget = bytes;
+    impl->applyBudget();
+}
+
+void ResourceContext::purgeUnlocked() {
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    for (const auto& res : impl->perDpi) res->purgeText();
+}
+
+} // namespace skplayer_ui
@@ -0,0 +1,69 @@
+// libs/skplayer_ui/src/RingBuffer.h
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace skplayer_ui {
+
+// Growable FIFO with O(1) push_back, pop_front and random access. Storage is
+// one vector used circularly; it doubles (re-laid out in order) when full
+// and is never shrunk. T must be default-constructible and movable.
+template <typename T>
+class RingBuffer {
+public:
+    RingBuffer() = default;
+
+    // Adopts `items` (oldest first) as the initial contents without copying.
+    explicit RingBuffer(std::vector<T> items) : slots_(std::move(items)), size_(slots_.size()) {}
+
+    [[nodiscard]] size_t size() const { return size_; }
+    [[nodiscard]] bool empty() const { return size_ == 0; }
+    [[nodiscard]] size_t capacity() const { return slots_.size(); }
+
+    // 0 = oldest
+    T& operator[](size_t i) { return slots_[slot(i)]; }
+    const T& operator[](size_t i) const { return slots_[slot(i)]; }
+
+    const T& front() const { return (*this)[0]; }
+    const T& back() const { return (*this)[size_ - 1]; }
+
+    void push_back(T value) {
+        if (size_ == slots_.size()) grow();
+        slots_[slot(size_)] = std::move(value);
+        ++size_;
+    }
+
+    void pop_front() {
+        if (size_ == 0) return;
+        slots_[head_] = T();  // Release what the element owns now
+        head_ = (head_ + 1 == slots_.size()) ? 0 : head_ + 1;
+        --size_;
+    }
+
+    void clear() {
+        slots_.clear();
+        head_ = 0;
+        size_ = 0;
+    }
+
+private:
+    size_t slot(size_t i) const {
+        const size_t at = head_ + i;
+        return at >= slots_.size() ? at - slots_.size() : at;
+    }
+
+    void grow() {
+        std::vector<T> next(slots_.empty() ? 8 : slots_.size() * 2);
+        for (size_t i = 0; i < size_; ++i) next[i] = std::move(slots_[slot(i)]);
+        slots_ = std::move(next);
+        head_ = 0;
+    }
+
+    std::vector<T> slots_;
+    size_t head_ = 0;
+    size_t size_ = 0;
+};
+
+} // namespace skplayer_ui
@@ -1,16 +1,27 @@
 // libs/skplayer_ui/src/SeekBar.h
 #pragma once
 
+#include "ContainerLayout.h"
+#include "DpiResources.h"
+#include "MotionLanes.h"
 #include "SeekBarState.h"
+#include "StatsRecorder.h"
 #include "Theme.h"
+#include "Trace.h"
+#include "VelocityTracker.h"
 
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColor.h"
 #include "include/core/SkPaint.h"
+#include "include/core/SkPath.h"
+#include "include/core/SkPathBuilder.h"
+#include "include/core/SkPoint.h"
 #include "include/core/SkRect.h"
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <vector>
 
 namespace skplayer_ui {
 
@@ -19,23 +30,44 @@ public:
     struct SeekEvent {
         enum class Type { None, Started, Completed };
         Type type = Type::None;
-        float position = 0.0f;
+        MediaTimeUs position = 0;
     };
 
-    explicit SeekBar(float dpi = 1.0f) : dpiScale_(std::max(dpi, 0.01f)) {}
-
-    void setState(const SeekBarState& state) { state_ = state; }
+    // Visibility, thumb scale, idle time and loading shimmer live in the
+    // container's `motion` row
+    SeekBar(const DpiResources& res, StatsRecorder& stats, const MotionRef& motion)
+        : res_(&res), stats_(&stats), motion_(&motion) {}
+
+    void setResources(const DpiResources& res) { res_ = &res; }
+    // Chapters and cues are referenced, not copied: the lists can hold tens
+    // of thousands of imported entries, so `state` must be the owner's (the
+    // container's) and outlive the bar.
+    void setState(const SeekBarState& state) {
+        state_.duration = state.duration;
+        state_.windowStart = state.windowStart;
+        state_.currentPosition = state.currentPosition;
+        state_.isLoading = state.isLoading;
+        chapters_ = &state.chapters;
+        cues_ = &state.cues;
+    }
+    void setPosition(MediaTimeUs position) { state_.currentPosition = position; }
     void setPortraitMode(bool portrait) { isPortrait_ = portrait; }
 
-    SeekEvent onTouchDown(float x, float y) {
+    // Geometry from the container's layout pass; render and hit-testing only read it.
+    void setGeometry(const SeekBarGeometry& geometry) { geometry_ = geometry; }
+
+    // `tNs` (optional, 0 = none) timestamps the event for drag velocity;
+    // see predictPreview().
+    SeekEvent onTouchDown(float x, float y, uint64_t tNs = 0) {
         if (state_.isLoading) return {};
 
         if (isPointOnThumb(x, y)) {
             isTouching_ = true;
             touchStartedOnBar_ = false;
-            updatePositionFromTouch(x);
+            velocity_.reset();
+            updatePositionFromTouch(x, tNs);
             resetInteractionTimer();
-            return {SeekEvent::Type::Started, 0.0f};
+            return {SeekEvent::Type::Started, 0};
         }
 
         if (isPointInInteractiveArea(x, y)) {
@@ -46,21 +78,22 @@ public:
         return {};
     }
 
-    SeekEvent onTouchMove(float x, [[maybe_unused]] float y) {
+    SeekEvent onTouchMove(float x, [[maybe_unused]] float y, uint64_t tNs = 0) {
         if (state_.isLoading) return {};
 
         if (isTouching_) {
-            updatePositionFromTouch(x);
+            updatePositionFromTouch(x, tNs);
             return {};
         }
 
         if (touchStartedOnBar_) {
             float dragDistance = std::abs(x - touchStartX_);
-            float threshold = theme::seekbar::kDragThresholdDp * dpiScale_;
+            float threshold = res_->metrics.seekBar.dragThreshold;
             if (dragDistance >= threshold) {
                 isTouching_ = true;
-                updatePositionFromTouch(x);
-                return {SeekEvent::Type::Started, 0.0f};
+                velocity_.reset();
+                updatePositionFromTouch(x, tNs);
+                return {SeekEvent::Type::Started, 0};
             }
         }
         return {};
@@ -76,37 +109,69 @@ public:
 
         if (isTouching_) {
             isTouching_ = false;
+            velocity_.reset();
+            displayedPreviewPosition_ = seekPreviewPosition_;
             return {SeekEvent::Type::Completed, seekPreviewPosition_};
         }
         return {};
     }
 
-    void update(float deltaTimeSeconds, bool isPlaying = true) {
-        updateVisibilityState(deltaTimeSeconds, isPlaying);
-        updateLoadingAnimation(deltaTimeSeconds);
+    // Discrete half of the auto-hide logic. Timers and smoothing are stepped
+    // by motion::advance.
+    void syncVisibility(bool isPlaying) {
+        if (!isPlaying && !controlsManuallyHidden_) {
+            resetInteractionTimer();
+        }
+    }
+
+    // Kernel inputs derived from the bar's touch and loading state
+    void writeMotionInputs(bool isPlaying) {
+        motion_->thumbTarget() = isTouching_ ? 1.5f : 1.0f;
+        motion_->idleCounting() = (isPlaying && !isTouching_ && !state_.isLoading) ? 1.0f : 0.0f;
+        motion_->loadingActive() = state_.isLoading ? 1.0f : 0.0f;
     }
 
-    float alpha() const { return controlsVisibilityAlpha_; }
-    float getPreviewPosition() const { return seekPreviewPosition_; }
+    float alpha() const { return motion_->controlsAlpha(); }
+
+    // The drag preview as drawn (thumb, tooltip). With prediction this runs
+    // ahead of the last touch; the seek on release always uses the touch.
+    MediaTimeUs getPreviewPosition() const { return displayedPreviewPosition_; }
+
+    // Moves the drag preview to where the pointer is expected to be at
+    // `presentNs` (the timestamps' clock), extrapolating timestamped moves.
+    // Returns whether the preview changed.
+    bool predictPreview(uint64_t presentNs) {
+        if (!isTouching_ || velocity_.empty()) return false;
+        const MediaTimeUs predicted = positionFromTouch(velocity_.predict(presentNs));
+        if (predicted == displayedPreviewPosition_) return false;
+        displayedPreviewPosition_ = predicted;
+        return true;
+    }
+
+    // True while the drawn preview is ahead of (or behind) the touch
+    [[nodiscard]] bool isPreviewPredicted() const {
+        return isTouching_ && displayedPreviewPosition_ != seekPreviewPosition_;
+    }
 
     void expand() { resetInteractionTimer(); }
 
     void collapse() {
         controlsManuallyHidden_ = true;
-        isControlsVisible_ = false;
+        motion_->controlsTarget() = 0.0f;
     }
 
-    void render(SkCanvas* canvas, const SkRect& bounds) {
-        if (!canvas) return;
+    void render(SkCanvas* canvas) {
+        SKPLAYER_TRACE_SCOPE("SeekBar::render");
+        if (!canvas || geometry_.bounds.isEmpty()) return;
 
-        auto p = computeRenderParams(bounds);
+        auto p = computeRenderParams();
 
         if (state_.isLoading) {
             renderLoading(canvas, p);
             return;
         }
 
-        if (!isPortrait_ && controlsVisibilityAlpha_ <= 0.01f) return;
+        if (!isPortrait_ && alpha() <= 0.01f) return;
 
         float progress = getProgress();
         float previewProgress = getPreviewProgress();
@@ -114,151 +179,127 @@ public:
         float chapterScale = isTouching_ ? theme::seekbar::kActiveChapterScale : 1.0f;
 
         renderTrack(canvas, p, progress, activeChapter, chapterScale);
+        renderCueMarkers(canvas, p);
         renderThumb(canvas, p, previewProgress);
     }
 
 private:
     // State
-    SeekBarState state_;
-    float dpiScale_ = 1.0f;
+    SeekBarState state_;  // chapters and cues unused, see chapters_/cues_
+    const ChapterTrack* chapters_ = &state_.chapters;
+    const CueTrack* cues_ = &state_.cues;
+    const DpiResources* res_;
+    StatsRecorder* stats_;
+    const MotionRef* motion_;
     bool isPortrait_ = true;
     bool isTouching_ = false;
     bool touchStartedOnBar_ = false;
     float touchStartX_ = 0.0f;
-    float seekPreviewPosition_ = 0.0f;
-    float timeSinceLastInteraction_ = 0.0f;
-    bool isControlsVisible_ = true;
+    MediaTimeUs seekPreviewPosition_ = 0;        // From the last touch; what a release commits
+    MediaTimeUs displayedPreviewPosition_ = 0;   // Drawn; predicted ahead when enabled
+    VelocityTracker velocity_;                   // Timestamped drag moves (x)
     bool controlsManuallyHidden_ = false;
-    float controlsVisibilityAlpha_ = 1.0f;
-    float thumbDragScale_ = 1.0f;
-    SkRect currentBounds_ = SkRect::MakeEmpty();
-    float loadingPhase_ = 0.0f;
-
-    // Layout helpers
-    float getTrackHeight() const {
-        float height = isPortrait_ ? theme::seekbar::kTrackHeightPortraitDp : theme::seekbar::kTrackHeightLandscapeDp;
-        return height * dpiScale_;
-    }
+    SeekBarGeometry geometry_;
 
-    float getTrackY(const SkRect& bounds) const {
-        float trackHeight = getTrackHeight();
-        return isPortrait_ ? bounds.top() : bounds.centerY() - trackHeight / 2.0f;
-    }
-
-    float getThumbY(const SkRect& bounds) const {
-        return getTrackY(bounds) + getTrackHeight() / 2.0f;
-    }
-
-    bool isYInInteractiveRange(float y) const {
-        float verticalExtension = theme::seekbar::kTouchExtensionAboveDp * dpiScale_;
-        float minY = currentBounds_.top() - verticalExtension;
-        float maxY = currentBounds_.bottom();
-        return y >= minY && y <= maxY;
+    // Hit-testing (touch area is inclusive on all edges)
+    bool isPointInInteractiveArea(float x, float y) const {
+        const SkRect& area = geometry_.touchArea;
+        if (area.isEmpty()) return false;
+        return x >= area.left() && x <= area.right() && y >= area.top() && y <= area.bottom();
     }
 
     bool isPointOnThumb(float x, float y) const {
-        if (currentBounds_.isEmpty() || state_.duration <= 0.0f) return false;
-        if (x < currentBounds_.left() || x > currentBounds_.right()) return false;
-        if (!isYInInteractiveRange(y)) return false;
+        if (state_.duration <= 0 || !isPointInInteractiveArea(x, y)) return false;
 
-        float touchRadius = theme::seekbar::kThumbTouchTargetDp / 2.0f * dpiScale_;
-        float progress = getPreviewProgress();
-        float thumbX = getThumbXPosition(currentBounds_, progress);
+        float touchRadius = res_->metrics.seekBar.thumbTouchRadius;
+        float thumbX = getThumbXPosition(geometry_.bounds, getPreviewProgress());
         return std::abs(x - thumbX) <= touchRadius;
     }
 
-    bool isPointInInteractiveArea(float x, float y) const {
-        if (currentBounds_.isEmpty()) return false;
-        if (x < currentBounds_.left() || x > currentBounds_.right()) return false;
-        return isYInInteractiveRange(y);
-    }
-
     void resetInteractionTimer() {
-        timeSinceLastInteraction_ = 0.0f;
-        isControlsVisible_ = true;
+        motion_->idleSeconds() = 0.0f;
+        motion_->controlsTarget() = 1.0f;
         controlsManuallyHidden_ = false;
     }
 
-    void updateVisibilityState(float deltaTime, bool isPlaying) {
-        if (isPlaying && !isTouching_ && !state_.isLoading) {
-            timeSinceLastInteraction_ += deltaTime;
-            if (timeSinceLastInteraction_ >= theme::seekbar::kAutoHideDelaySeconds) {
-                isControlsVisible_ = false;
-            }
-        } else if (!isPlaying && !controlsManuallyHidden_) {
-            resetInteractionTimer();
-        }
+    float getAnimatedThumbRadius() const {
+        float minRadius = geometry_.trackHeight / 1.5f;
+        float maxRadius = res_->metrics.seekBar.thumbRadius;
+        float t = alpha();
+        return (minRadius + (maxRadius - minRadius) * t) * motion_->thumbScale();
+    }
 
-        float targetAlpha = isControlsVisible_ ? 1.0f : 0.0f;
-        float fadeSpeed = (targetAlpha > controlsVisibilityAlpha_) 
-            ? theme::seekbar::kFadeInSpeed : theme::seekbar::kFadeOutSpeed;
-        float alphaDiff = targetAlpha - controlsVisibilityAlpha_;
-        controlsVisibilityAlpha_ += alphaDiff * fadeSpeed * deltaTime;
-        controlsVisibilityAlpha_ = std::clamp(controlsVisibilityAlpha_, 0.0f, 1.0f);
+    SkColor getAnimatedProgressColor() const {
+        return theme::lerpColor(theme::colors::kProgressHidden,
+                                theme::colors::kProgressVisible,
+                                alpha());
+    }
 
-        float targetScale = isTouching_ ? 1.5f : 1.0f;
-        float scaleDiff = targetScale - thumbDragScale_;
-        thumbDragScale_ += scaleDiff * theme::seekbar::kThumbScaleAnimationSpeed * deltaTime;
-        thumbDragScale_ = std::clamp(thumbDragScale_, 1.0f, 1.5f);
+    // Stream time -> fraction of the window
+    float toProgress(MediaTimeUs t) const {
+        if (state_.duration <= 0) return 0.0f;
+        const double progress = static_cast<double>(t - state_.windowStart) / static_cast<double>(state_.duration);
+        return static_cast<float>(std::clamp(progress, 0.0, 1.0));
     }
 
-    void updateLoadingAnimation(float deltaTime) {
-        if (!state_.isLoading) return;
-        float dt = std::max(deltaTime, 0.0f);
-        loadingPhase_ += dt * theme::seekbar::kLoadingAnimationSpeed;
-        loadingPhase_ -= std::floor(loadingPhase_);
+    // Fraction of the window -> stream time
+    MediaTimeUs fromProgress(float progress) const {
+        return state_.windowStart + std::llround(static_cast<double>(progress) * static_cast<double>(state_.duration));
     }
 
-    float getAnimatedThumbRadius() const {
-        float minRadius = getTrackHeight() / 1.5f;
-        float maxRadius = theme::seekbar::kThumbRadiusDp * dpiScale_;
-        float t = controlsVisibilityAlpha_;
-        return (minRadius + (maxRadius - minRadius) * t) * thumbDragScale_;
+    // Stream time -> x in cache pixels, relative to a cache origin (see
+    // drawSegmentedBar). The difference is taken in integer microseconds
+    // before anything becomes a float, so x keeps sub-pixel precision however
+    // far into a stream `t` lies.
+    static float toPx(MediaTimeUs t, MediaTimeUs originUs, float pxPerSecond) {
+        return static_cast<float>(media_time::toSeconds(t - originUs) * pxPerSecond);
     }
 
-    SkColor getAnimatedProgressColor() const {
-        return theme::lerpColor(theme::colors::kProgressHidden,
-                                theme::colors::kProgressVisible,
-                                controlsVisibilityAlpha_);
+    // A cache origin is rebased once the window has slid more than its own
+    // length past it (or back before it), so cached x stays within a few
+    // window widths of zero.
+    bool originOutOfReach(MediaTimeUs originUs) const {
+        return originUs < state_.windowStart - state_.duration || originUs > state_.windowEnd();
     }
 
-    float getProgress() const {
-        return (state_.duration > 0.0f) ? state_.currentPosition / state_.duration : 0.0f;
+    float pixelsPerSecond(const SkRect& bounds) const {
+        return static_cast<float>(bounds.width() / media_time::toSeconds(state_.duration));
     }
 
+    float getProgress() const { return toProgress(state_.currentPosition); }
+
     float getPreviewProgress() const {
-        if (state_.duration > 0.0f) {
-            return isTouching_ ? (seekPreviewPosition_ / state_.duration) 
-                               : (state_.currentPosition / state_.duration);
-        }
-        return 0.0f;
+        return toProgress(isTouching_ ? displayedPreviewPosition_ : state_.currentPosition);
     }
 
-    void updatePositionFromTouch(float x) {
-        if (currentBounds_.width() > 0 && state_.duration > 0.0f) {
-            float localX = x - currentBounds_.left();
-            float progress = std::clamp(localX / currentBounds_.width(), 0.0f, 1.0f);
-            seekPreviewPosition_ = progress * state_.duration;
-        }
+    MediaTimeUs positionFromTouch(float x) const {
+        const SkRect& bounds = geometry_.bounds;
+        if (bounds.width() <= 0 || state_.duration <= 0) return seekPreviewPosition_;
+        float localX = x - bounds.left();
+        float progress = std::clamp(localX / bounds.width(), 0.0f, 1.0f);
+        return fromProgress(progress);
+    }
+
+    void updatePositionFromTouch(float x, uint64_t tNs) {
+        if (tNs != 0) velocity_.add(x, tNs);
+        seekPreviewPosition_ = positionFromTouch(x);
+        displayedPreviewPosition_ = seekPreviewPosition_;
     }
 
     float getThumbXPosition(const SkRect& bounds, float progress) const {
-        return bounds.left() + bounds.width() * progress - (2.0f * dpiScale_);
+        return bounds.left() + bounds.width() * progress - res_->metrics.seekBar.thumbOffset;
     }
 
+    // Chapter whose [start, next start) span contains `progress`; binary
+    // search, since imported lists can be long.
     int getCurrentChapterIndex(float progress) const {
-        if (state_.chapters.empty() || state_.duration <= 0.0f) return -1;
-        for (size_t i = 0; i < state_.chapters.size(); ++i) {
-            float chapterStart = state_.chapters[i].startTime / state_.duration;
-            float chapterEnd = (i + 1 < state_.chapters.size())
-                ? state_.chapters[i + 1].startTime / state_.duration : 1.0f;
-            if (progress >= chapterStart && progress <= chapterEnd) {
-                return static_cast<int>(i);
-            }
-        }
-        return -1;
+        if (chapters().empty() || state_.duration <= 0 || progress > 1.0f) return -1;
+        return chapters().indexAt(fromProgress(progress));
     }
 
+    const ChapterTrack& chapters() const { return *chapters_; }
+    const CueTrack& cues() const { return *cues_; }
+
     // Render helpers
     struct RenderParams {
         SkRect bounds;
@@ -267,20 +308,10 @@ private:
         uint8_t alpha;
     };
 
-    RenderParams computeRenderParams(const SkRect& inputBounds) {
-        float margin = isPortrait_ ? 0.0f : theme::seekbar::kLandscapeMarginDp * dpiScale_;
-        SkRect bounds = SkRect::MakeXYWH(
-            inputBounds.left() + margin, inputBounds.top(),
-            inputBounds.width() - margin * 2, inputBounds.height()
-        );
-        currentBounds_ = bounds;
-
-        float trackHeight = getTrackHeight();
-        float trackY = getTrackY(bounds);
-        float visAlpha01 = std::clamp(controlsVisibilityAlpha_, 0.0f, 1.0f);
+    RenderParams computeRenderParams() const {
+        float visAlpha01 = std::clamp(alpha(), 0.0f, 1.0f);
         uint8_t alpha = isPortrait_ ? 255 : static_cast<uint8_t>(255.0f * visAlpha01);
-
-        return {bounds, trackY, trackHeight, alpha};
+        return {geometry_.bounds, geometry_.trackY, geometry_.trackHeight, alpha};
     }
 
     void renderLoading(SkCanvas* canvas, const RenderParams& p) {
@@ -293,10 +324,11 @@ private:
         fgPaint.setColor(theme::withAlpha(theme::colors::kWhite, p.alpha));
         fgPaint.setAntiAlias(true);
 
-        float segW = std::max(p.bounds.width() * 0.44f, 56.0f * dpiScale_);
+        float segW = std::max(p.bounds.width() * 0.44f, res_->metrics.seekBar.loadingSegmentMinWidth);
         float travel = p.bounds.width() + segW * 2.0f;
-        float x = p.bounds.left() - segW + loadingPhase_ * travel;
+        float x = p.bounds.left() - segW + motion_->loadingPhase() * travel;
         canvas->drawRect(SkRect::MakeXYWH(x, p.trackY, segW, p.trackHeight), fgPaint);
+        stats_->draw(Component::SeekBar, 2);
     }
 
     void renderTrack(SkCanvas* canvas, const RenderParams& p, float progress, int activeChapter, float chapterScale) {
@@ -305,73 +337,213 @@ private:
         bgPaint.setAntiAlias(true);
         SkColor activeChapterBgColor = (isTouching_ && activeChapter >= 0)
             ? theme::withAlpha(theme::colors::kWhite, p.alpha) : 0;
-        drawSegmentedBar(canvas, p.bounds, p.trackY, p.trackHeight, 1.0f, bgPaint,
-                         activeChapter, chapterScale, activeChapterBgColor);
+        drawSegmentedBar(canvas, p, 1.0f, bgPaint, activeChapter, chapterScale, activeChapterBgColor);
 
         SkPaint progressPaint;
         progressPaint.setColor(theme::withAlpha(getAnimatedProgressColor(), p.alpha));
         progressPaint.setAntiAlias(true);
-        drawSegmentedBar(canvas, p.bounds, p.trackY, p.trackHeight, progress, progressPaint,
-                         activeChapter, chapterScale, 0);
+        drawSegmentedBar(canvas, p, progress, progressPaint, activeChapter, chapterScale, 0);
     }
 
     void renderThumb(SkCanvas* canvas, const RenderParams& p, float previewProgress) {
         float thumbX = getThumbXPosition(p.bounds, previewProgress);
-        float thumbY = getThumbY(p.bounds);
+        float thumbY = geometry_.thumbY();
         float thumbRadius = getAnimatedThumbRadius();
 
         SkPaint thumbPaint;
         thumbPaint.setColor(theme::withAlpha(getAnimatedProgressColor(), p.alpha));
         thumbPaint.setAntiAlias(true);
         canvas->drawCircle(thumbX, thumbY, thumbRadius, thumbPaint);
+        stats_->draw(Component::SeekBar);
     }
 
-    void drawSegmentedBar(SkCanvas* canvas, const SkRect& bounds, float trackY, float trackHeight,
-                          float endProgress, SkPaint& paint, int activeChapterIndex = -1,
-                          float activeChapterScale = 1.0f, SkColor activeChapterColor = 0) {
-        if (state_.chapters.empty() || state_.duration <= 0.0f) {
-            float width = bounds.width() * endProgress;
-            canvas->drawRect(SkRect::MakeXYWH(bounds.left(), trackY, width, trackHeight), paint);
+    // =========================================================================
+    // Chapter segments
+    // =========================================================================
+    //
+    // Every chapter but the last is a closed segment (it ends where the next
+    // starts) and never changes shape, so closed segments are cached in one
+    // path laid out in cache pixels (x = (t - originUs) * pxPerSecond). A
+    // frame draws the path translated by the window start and clipped to the
+    // track; only the open last segment and the active chapter are drawn as
+    // rects. When chapters are appended at the live edge the new segments are
+    // added to the path; expired ones stay in it (clipped off to the left)
+    // until they make up half of it, or until the window has slid past the
+    // origin (see originOutOfReach).
+
+    struct SegmentCache {
+        SkPathBuilder builder;
+        SkPath path;
+        const ChapterTrack* track = nullptr;
+        uint64_t epoch = 0;
+        uint64_t beginSeq = 0;  // Sequence numbers of the segments in the path
+        uint64_t endSeq = 0;
+        MediaTimeUs originUs = 0;  // Stream time at x = 0
+        float pxPerSecond = 0.0f;
+        float trackY = 0.0f;
+        float trackHeight = 0.0f;
+        float halfGap = 0.0f;
+    };
+    SegmentCache segments_;
+
+    // Segment from `startPx` to `endPx` in cache pixels, inset by half a
+    // chapter gap on the sides that border another chapter.
+    static SkRect segmentRect(float startPx, uint64_t seq, float endPx, bool closed,
+                              float halfGap, float y, float h) {
+        const float left = startPx + (seq > 0 ? halfGap : 0.0f);
+        const float right = endPx - (closed ? halfGap : 0.0f);
+        return right > left ? SkRect::MakeLTRB(left, y, right, y + h) : SkRect::MakeEmpty();
+    }
+
+    void updateSegmentCache(const RenderParams& p, float pxPerSecond, float halfGap) {
+        const ChapterTrack& list = chapters();
+        SegmentCache& c = segments_;
+        const uint64_t first = list.firstSeq();
+        const uint64_t closedEnd = first + list.size() - 1;
+
+        // Window length changes rescale everything; ignore float jitter in it.
+        const bool stale = c.track != &list || c.epoch != list.epoch() ||
+                           std::abs(c.pxPerSecond - pxPerSecond) > pxPerSecond * 1e-5f ||
+                           c.trackY != p.trackY || c.trackHeight != p.trackHeight ||
+                           c.halfGap != halfGap || c.endSeq < first || c.endSeq > closedEnd ||
+                           (first - c.beginSeq) * 2 > c.endSeq - c.beginSeq || originOutOfReach(c.originUs);
+        if (stale) {
+            c.builder = SkPathBuilder();
+            c.track = &list;
+            c.epoch = list.epoch();
+            c.beginSeq = c.endSeq = first;
+            c.originUs = state_.windowStart;
+            c.pxPerSecond = pxPerSecond;
+            c.trackY = p.trackY;
+            c.trackHeight = p.trackHeight;
+            c.halfGap = halfGap;
+        } else if (c.endSeq == closedEnd) {
             return;
         }
 
-        float gapWidth = theme::seekbar::kChapterGapDp * dpiScale_;
-        float halfGap = gapWidth / 2;
-        bool hasActiveColor = (SkColorGetA(activeChapterColor) > 0);
-        size_t numChapters = state_.chapters.size();
-
-        for (size_t i = 0; i < numChapters; ++i) {
-            float chapterStart = state_.chapters[i].startTime / state_.duration;
-            float chapterEnd = (i + 1 < numChapters)
-                ? state_.chapters[i + 1].startTime / state_.duration : 1.0f;
-
-            bool isActiveChapter = (static_cast<int>(i) == activeChapterIndex);
-            if (chapterStart >= endProgress) break;
-
-            float segmentEnd = std::min(chapterEnd, endProgress);
-            float startX = bounds.left() + bounds.width() * chapterStart;
-            float endX = bounds.left() + bounds.width() * segmentEnd;
+        for (uint64_t seq = c.endSeq; seq < closedEnd; ++seq) {
+            const size_t i = static_cast<size_t>(seq - first);
+            SkRect r = segmentRect(toPx(list.startUs(i), c.originUs, c.pxPerSecond), seq,
+                                   toPx(list.startUs(i + 1), c.originUs, c.pxPerSecond), true, halfGap,
+                                   p.trackY, p.trackHeight);
+            if (!r.isEmpty()) c.builder.addRect(r);
+        }
+        c.endSeq = closedEnd;
+        c.path = c.builder.snapshot();
+        stats_->add(StatsRecorder::PathsBuilt);
+        stats_->add(StatsRecorder::Allocations);
+    }
 
-            if (i > 0) startX += halfGap;
-            if (i + 1 < numChapters) endX -= halfGap;
+    void drawSegmentedBar(SkCanvas* canvas, const RenderParams& p, float endProgress, const SkPaint& paint,
+                          int activeChapterIndex = -1, float activeChapterScale = 1.0f,
+                          SkColor activeChapterColor = 0) {
+        const SkRect& bounds = p.bounds;
+        const float endX = bounds.left() + bounds.width() * endProgress;
+        if (chapters().empty() || state_.duration <= 0) {
+            canvas->drawRect(SkRect::MakeLTRB(bounds.left(), p.trackY, endX, p.trackY + p.trackHeight), paint);
+            stats_->draw(Component::SeekBar);
+            return;
+        }
 
-            float segmentWidth = endX - startX;
-            if (segmentWidth > 0) {
-                float heightToUse = trackHeight;
-                float yToUse = trackY;
-                if (isActiveChapter && activeChapterScale > 1.0f) {
-                    heightToUse = trackHeight * activeChapterScale;
-                    yToUse = trackY - (heightToUse - trackHeight) / 2;
-                }
+        const float pxPerSecond = pixelsPerSecond(bounds);
+        const float halfGap = res_->metrics.seekBar.chapterGap / 2;
+        updateSegmentCache(p, pxPerSecond, halfGap);
+
+        const float grow = (activeChapterScale > 1.0f) ? p.trackHeight * (activeChapterScale - 1.0f) : 0.0f;
+        canvas->save();
+        canvas->clipRect(SkRect::MakeLTRB(bounds.left(), p.trackY - grow, endX, p.trackY + p.trackHeight + grow));
+        const MediaTimeUs origin = segments_.originUs;
+        canvas->translate(bounds.left() - toPx(state_.windowStart, origin, pxPerSecond), 0.0f);
+        canvas->drawPath(segments_.path, paint);
+        uint64_t draws = 1;
+
+        const size_t numChapters = chapters().size();
+        const float windowEndPx = toPx(state_.windowEnd(), origin, pxPerSecond);
+        const size_t last = numChapters - 1;
+        SkRect open = segmentRect(toPx(chapters().startUs(last), origin, pxPerSecond), chapters().firstSeq() + last,
+                                  windowEndPx, false, halfGap, p.trackY, p.trackHeight);
+        if (!open.isEmpty()) {
+            canvas->drawRect(open, paint);
+            ++draws;
+        }
 
+        if (activeChapterIndex >= 0 && static_cast<size_t>(activeChapterIndex) < numChapters) {
+            const auto i = static_cast<size_t>(activeChapterIndex);
+            const bool closed = i + 1 < numChapters;
+            const float heightToUse = p.trackHeight * std::max(activeChapterScale, 1.0f);
+            const float yToUse = p.trackY - (heightToUse - p.trackHeight) / 2;
+            SkRect active = segmentRect(toPx(chapters().startUs(i), origin, pxPerSecond), chapters().firstSeq() + i,
+                                        closed ? toPx(chapters().startUs(i + 1), origin, pxPerSecond) : windowEndPx,
+                                        closed, halfGap, yToUse, heightToUse);
+            if (!active.isEmpty()) {
                 SkPaint paintToUse = paint;
-                if (isActiveChapter && hasActiveColor) {
-                    paintToUse.setColor(activeChapterColor);
-                }
+                if (SkColorGetA(activeChapterColor) > 0) paintToUse.setColor(activeChapterColor);
+                canvas->drawRect(active, paintToUse);
+                ++draws;
+            }
+        }
+        canvas->restore();
+        stats_->draw(Component::SeekBar, draws);
+    }
 
-                canvas->drawRect(SkRect::MakeXYWH(startX, yToUse, segmentWidth, heightToUse), paintToUse);
+    // =========================================================================
+    // Cue markers
+    // =========================================================================
+    //
+    // One vertical tick per cue, kept as line endpoints in cache pixels
+    // (rebuilt only when the cues, scale, track or origin move) and drawn
+    // with a single drawPoints over the cues inside the window.
+
+    struct MarkerCache {
+        std::vector<SkPoint> points;
+        const CueTrack* track = nullptr;
+        uint64_t epoch = 0;
+        MediaTimeUs originUs = 0;  // Stream time at x = 0
+        float pxPerSecond = 0.0f;
+        float trackY = 0.0f;
+        float trackHeight = 0.0f;
+    };
+    MarkerCache markers_;
+
+    void renderCueMarkers(SkCanvas* canvas, const RenderParams& p) {
+        const CueTrack& list = cues();
+        if (list.empty() || state_.duration <= 0) return;
+
+        const float pxPerSecond = pixelsPerSecond(p.bounds);
+        MarkerCache& c = markers_;
+        if (c.track != &list || c.epoch != list.epoch() ||
+            std::abs(c.pxPerSecond - pxPerSecond) > pxPerSecond * 1e-5f ||
+            c.trackY != p.trackY || c.trackHeight != p.trackHeight || originOutOfReach(c.originUs)) {
+            c.originUs = state_.windowStart;
+            if (list.size() * 2 > c.points.capacity()) stats_->add(StatsRecorder::Allocations);
+            c.points.resize(list.size() * 2);
+            for (size_t i = 0; i < list.size(); ++i) {
+                const float x = toPx(list.timeUs(i), c.originUs, pxPerSecond);
+                c.points[i * 2] = SkPoint::Make(x, p.trackY);
+                c.points[i * 2 + 1] = SkPoint::Make(x, p.trackY + p.trackHeight);
             }
+            c.track = &list;
+            c.epoch = list.epoch();
+            c.pxPerSecond = pxPerSecond;
+            c.trackY = p.trackY;
+            c.trackHeight = p.trackHeight;
         }
+
+        const size_t first = list.lowerBound(state_.windowStart);
+        const size_t last = list.upperBound(state_.windowEnd());
+        if (first >= last) return;
+
+        SkPaint paint;
+        paint.setColor(theme::withAlpha(theme::colors::kCueMarker, p.alpha));
+        paint.setStrokeWidth(res_->metrics.seekBar.cueMarkerWidth);
+        paint.setStrokeCap(SkPaint::kButt_Cap);
+        paint.setAntiAlias(true);
+
+        canvas->save();
+        canvas->translate(p.bounds.left() - toPx(state_.windowStart, c.originUs, c.pxPerSecond), 0.0f);
+        canvas->drawPoints(SkCanvas::kLines_PointMode, (last - first) * 2, c.points.data() + first * 2, paint);
+        canvas->restore();
+        stats_->draw(Component::SeekBar);
     }
 };
 
@@ -1,9 +1,9 @@
 // libs/skplayer_ui/src/SeekBarState.h
 #pragma once
 
-#include "skplayer_ui/VideoContainer.h"  // for Chapter
-
-#include <vector>
+#include "skplayer_ui/MediaTime.h"
+#include "ChapterTrack.h"
+#include "CueTrack.h"
 
 namespace skplayer_ui {
 
@@ -12,11 +12,17 @@ enum class SeekDirection : int {
     Forward = 1
 };
 
+// Times are stream time. For VOD the window is the whole stream
+// ([0, duration]); in live mode it is the seekable DVR range, sliding forward.
 struct SeekBarState {
-    float duration = 0.0f;
-    float currentPosition = 0.0f;
-    std::vector<Chapter> chapters;
+    MediaTimeUs duration = 0;    // Window length
+    MediaTimeUs windowStart = 0;
+    MediaTimeUs currentPosition = 0;
+    ChapterTrack chapters;
+    CueTrack cues;
     bool isLoading = false;
+
+    MediaTimeUs windowEnd() const { return windowStart + duration; }
 };
 
 } // namespace skplayer_ui
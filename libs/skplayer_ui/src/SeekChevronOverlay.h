@@ -1,12 +1,14 @@
 // libs/skplayer_ui/src/SeekChevronOverlay.h
 #pragma once
 
+#include "DpiResources.h"
+#include "MotionLanes.h"
 #include "SeekBarState.h"  // SeekDirection
 #include "Theme.h"
 
 #include "include/core/SkCanvas.h"
-#include "include/core/SkPaint.h"
-#include "include/core/SkPathBuilder.h"
+#include "include/core/SkRSXform.h"
+#include "include/core/SkRect.h"
 
 #include <algorithm>
 #include <array>
@@ -15,8 +17,10 @@ namespace skplayer_ui {
 
 class SeekChevronOverlay {
 public:
-    explicit SeekChevronOverlay(float dpiScale)
-        : dpiScale_(std::max(dpiScale, 0.01f)) {}
+    // Particle ages live in the container's `motion` row
+    SeekChevronOverlay(const DpiResources& res, const MotionRef& motion) : res_(&res), motion_(&motion) {}
+
+    void setResources(const DpiResources& res) { res_ = &res; }
 
     void onSeekFeedbackUpdated(int totalSeconds, bool burstActive) {
         dir_ = (totalSeconds < 0) ? SeekDirection::Backward : SeekDirection::Forward;
@@ -26,32 +30,23 @@ public:
 
     void setBurstActive(bool active) { burstActive_ = active; }
 
-    void update(float dt) {
-        dt = std::max(dt, 0.0f);
-        for (auto& p : particles_) {
-            if (!p.active) continue;
-            p.age += dt;
-            if (p.age >= theme::chevron::kParticleDurationSeconds) {
-                p.active = false;
-            }
-        }
-    }
-
     [[nodiscard]] bool isAnimating() const {
-        return std::any_of(particles_.begin(), particles_.end(),
-                           [](const auto& p) { return p.active; });
+        for (int i = 0; i < kMaxParticles; ++i) {
+            if (isLive(motion_->particleAge(i))) return true;
+        }
+        return false;
     }
 
-    void draw(SkCanvas* canvas, float centerY, uint8_t baseAlpha,
+    // True if it issued a draw call
+    bool draw(SkCanvas* canvas, float centerY, uint8_t baseAlpha,
               float screenWidth, bool isPortrait) const {
-        if (!canvas || baseAlpha == 0) return;
+        if (!canvas || baseAlpha == 0) return false;
 
-        const float edgeMarginDp = isPortrait
-            ? theme::layout::kOverlayEdgeMarginDp
-            : theme::layout::kOverlayChevronEdgeMarginLandscapeDp;
-        const float edgeMargin = edgeMarginDp * dpiScale_;
-        const float chevronH = theme::chevron::kHeightDp * dpiScale_;
-        const float chevronW = chevronH * 0.5f;
+        const ThemeMetrics& m = res_->metrics;
+        const float edgeMargin = isPortrait
+            ? m.overlay.edgeMarginPortrait
+            : m.overlay.chevronEdgeMarginLandscape;
+        const float chevronW = m.chevron.width;
 
         auto clampX = [&](float x) {
             float minX = edgeMargin;
@@ -64,78 +59,72 @@ public:
             ? (screenWidth - edgeMargin - chevronW)
             : edgeMargin);
 
-        const float travel = theme::chevron::kTravelDistanceDp * dpiScale_;
+        const float travel = m.chevron.travel;
         float startX = clampX(endX - dirValue * travel);
 
-        SkPaint paint;
-        paint.setAntiAlias(true);
-        paint.setStyle(SkPaint::kStroke_Style);
-        paint.setStrokeWidth(theme::chevron::kStrokeWidthDp * dpiScale_);
-        paint.setStrokeCap(SkPaint::kRound_Cap);
-        paint.setStrokeJoin(SkPaint::kRound_Join);
+        // Stationary chevron + live particles as sprites of one atlas draw
+        const ChevronAtlas& atlas = res_->chevrons;
+        if (!atlas.image) return false;
+
+        std::array<SkRSXform, kMaxParticles + 1> xforms;
+        std::array<SkRect, kMaxParticles + 1> sprites;
+        std::array<SkColor, kMaxParticles + 1> colors;
+        int count = 0;
+
+        auto addSprite = [&](float x, uint8_t alpha) {
+            xforms[count] = SkRSXform::Make(1.0f, 0.0f, x - atlas.anchorX, centerY - atlas.anchorY);
+            sprites[count] = atlas.sprite(dir_);
+            colors[count] = theme::withAlpha(theme::colors::kWhite, alpha);
+            ++count;
+        };
 
         // Stationary chevron at end while bursting
-        if (burstActive_) {
-            paint.setColor(theme::withAlpha(theme::colors::kWhite, baseAlpha));
-            drawChevron(canvas, endX, chevronW, chevronH, centerY, paint, dir_);
-        }
+        if (burstActive_) addSprite(endX, baseAlpha);
 
         // Transient chevrons moving towards end
-        for (const auto& p : particles_) {
-            if (!p.active) continue;
-            float t = std::clamp(p.age / theme::chevron::kParticleDurationSeconds, 0.0f, 1.0f);
+        for (int i = 0; i < kMaxParticles; ++i) {
+            const float age = motion_->particleAge(i);
+            if (!isLive(age)) continue;
+            float t = std::clamp(age / theme::chevron::kParticleDurationSeconds, 0.0f, 1.0f);
             float x = startX + (endX - startX) * t;
-            auto a = static_cast<uint8_t>(std::clamp(baseAlpha * t, 0.0f, 255.0f));
-            paint.setColor(theme::withAlpha(theme::colors::kWhite, a));
-            drawChevron(canvas, x, chevronW, chevronH, centerY, paint, dir_);
+            addSprite(x, static_cast<uint8_t>(std::clamp(baseAlpha * t, 0.0f, 255.0f)));
         }
+
+        if (count == 0) return false;
+        // kModulate: sprite color (white, per-sprite alpha) scales the white glyph
+        canvas->drawAtlas(atlas.image.get(), xforms.data(), sprites.data(), colors.data(), count,
+                          SkBlendMode::kModulate, SkSamplingOptions(SkFilterMode::kLinear),
+                          nullptr, nullptr);
+        return true;
     }
 
 private:
-    struct Particle {
-        bool active = false;
-        float age = 0.0f;
-    };
+    // A particle is live until its age reaches the particle duration; ages
+    // are clamped there, so no separate active flag is needed.
+    static bool isLive(float age) { return age < theme::chevron::kParticleDurationSeconds; }
 
     void spawnParticle() {
         // Reuse first inactive slot, otherwise overwrite oldest
         int best = 0;
         float oldestAge = -1.0f;
-        for (int i = 0; i < theme::chevron::kMaxParticles; ++i) {
-            if (!particles_[i].active) {
+        for (int i = 0; i < kMaxParticles; ++i) {
+            const float age = motion_->particleAge(i);
+            if (!isLive(age)) {
                 best = i;
                 break;
             }
-            if (particles_[i].age > oldestAge) {
-                oldestAge = particles_[i].age;
+            if (age > oldestAge) {
+                oldestAge = age;
                 best = i;
             }
         }
-        particles_[best] = {true, 0.0f};
-    }
-
-    static void drawChevron(SkCanvas* canvas, float x, float w, float h,
-                            float centerY, const SkPaint& paint, SeekDirection dir) {
-        float topY = centerY - h * 0.5f;
-        float botY = centerY + h * 0.5f;
-
-        SkPathBuilder b;
-        if (dir == SeekDirection::Forward) {
-            b.moveTo(x, topY);
-            b.lineTo(x + w, centerY);
-            b.lineTo(x, botY);
-        } else {
-            b.moveTo(x + w, topY);
-            b.lineTo(x, centerY);
-            b.lineTo(x + w, botY);
-        }
-        canvas->drawPath(b.detach(), paint);
+        motion_->particleAge(best) = 0.0f;
     }
 
-    float dpiScale_;
+    const DpiResources* res_;
+    const MotionRef* motion_;
     SeekDirection dir_ = SeekDirection::Forward;
     bool burstActive_ = false;
-    std::array<Particle, theme::chevron::kMaxParticles> particles_{};
 };
 
 } // namespace skplayer_ui
@@ -1,27 +1,38 @@
 // libs/skplayer_ui/src/SeekFeedbackOverlay.h
 #pragma once
 
+#include "DpiResources.h"
+#include "MotionLanes.h"
 #include "UIState.h"
 #include "SeekChevronOverlay.h"
+#include "StatsRecorder.h"
 #include "Theme.h"
+#include "Trace.h"
 
 #include "include/core/SkCanvas.h"
-#include "include/core/SkFont.h"
 #include "include/core/SkPaint.h"
-#include "include/core/SkTypeface.h"
 
 namespace skplayer_ui {
 
 // Renders the seek feedback overlay: "- 10" / "+ 20" text with chevrons
 class SeekFeedbackOverlay {
 public:
-    explicit SeekFeedbackOverlay(float dpiScale = 1.0f, sk_sp<SkTypeface> typeface = nullptr)
-        : dpiScale_(std::max(dpiScale, 0.01f))
-        , chevrons_(dpiScale_)
-        , typeface_(std::move(typeface)) {}
+    // The timer and pulse live in the container's `motion` row
+    SeekFeedbackOverlay(const DpiResources& res, StatsRecorder& stats, const MotionRef& motion)
+        : res_(&res)
+        , stats_(&stats)
+        , motion_(&motion)
+        , chevrons_(res, motion) {}
+
+    void setResources(const DpiResources& res) {
+        res_ = &res;
+        chevrons_.setResources(res);
+    }
 
     void show(int totalSeconds) {
-        feedback_.show(totalSeconds, theme::layout::kFeedbackDurationSeconds);
+        feedback_.show(totalSeconds);
+        motion_->feedbackTimer() = theme::layout::kFeedbackDurationSeconds;
+        motion_->feedbackPulse() = 1.0f;
         chevrons_.onSeekFeedbackUpdated(totalSeconds, true);
     }
 
@@ -29,61 +40,67 @@ public:
         chevrons_.setBurstActive(active);
     }
 
-    void update(float dt) {
-        feedback_.update(dt);
-        chevrons_.update(dt);
+    bool isActive() const { return timer() > 0.0f && !feedback_.text.empty(); }
+    int totalSeconds() const { return feedback_.totalSeconds; }
+    float timer() const { return motion_->feedbackTimer(); }
+
+    // Text left mid-way through its display time, without the pulse and
+    // chevron animation of show() (see VideoContainer::restore)
+    void restore(int totalSeconds, float timer) {
+        feedback_ = SeekFeedback();
+        motion_->feedbackTimer() = std::max(timer, 0.0f);
+        motion_->feedbackPulse() = 0.0f;
+        if (timer > 0.0f) feedback_.show(totalSeconds);
     }
-
-    bool isActive() const { return feedback_.isActive(); }
     bool isAnimating() const { return chevrons_.isAnimating(); }
     SeekDirection direction() const { return feedback_.direction; }
 
     void render(SkCanvas* canvas, float centerY, float screenWidth, bool isPortrait) {
-        if (!feedback_.isActive()) return;
+        SKPLAYER_TRACE_SCOPE("SeekFeedbackOverlay::render");
+        if (!isActive()) return;
 
-        float alpha = std::min(feedback_.timer / 0.2f, 1.0f) * 255.0f;
+        float alpha = std::min(timer() / theme::layout::kFeedbackFadeOutSeconds, 1.0f) * 255.0f;
         SkPaint textPaint;
         textPaint.setColor(theme::withAlpha(theme::colors::kWhite, static_cast<uint8_t>(alpha)));
         textPaint.setAntiAlias(true);
 
-        SkFont font;
-        font.setSize(theme::layout::kOverlayFontSizeDp * dpiScale_);
-        font.setEmbolden(true);
-        if (typeface_) font.setTypeface(typeface_);
+        const ThemeMetrics& m = res_->metrics;
+        uint32_t shaped = 0;
+        const CachedText label = res_->overlayText.get(feedback_.text, &shaped);
+        stats_->shapedText(shaped);
 
-        const float baselineY = centerY + font.getSize() * 0.35f;
-        SkScalar textWidth = font.measureText(feedback_.text.c_str(), feedback_.text.size(), SkTextEncoding::kUTF8);
+        const float baselineY = centerY + m.overlay.fontSize * 0.35f;
+        const float textWidth = label.width;
 
-        const float edgeMargin = (isPortrait ? theme::layout::kOverlayEdgeMarginDp
-                                             : theme::layout::kOverlayEdgeMarginLandscapeDp) * dpiScale_;
-        const float gap = theme::layout::kOverlayChevronGapDp * dpiScale_;
-        const float chevronH = theme::chevron::kHeightDp * dpiScale_;
-        const float chevronW = chevronH * 0.5f;
+        const float edgeMargin = isPortrait ? m.overlay.edgeMarginPortrait : m.overlay.edgeMarginLandscape;
+        const float gap = m.overlay.chevronGap;
+        const float chevronW = m.chevron.width;
         int dir = static_cast<int>(feedback_.direction);
 
         float chevronEndX = (dir > 0) ? (screenWidth - edgeMargin - chevronW) : edgeMargin;
         float textX = (dir > 0) ? (chevronEndX - gap - textWidth) : (chevronEndX + chevronW + gap);
         textX = std::clamp(textX, edgeMargin, std::max(edgeMargin, screenWidth - edgeMargin - textWidth));
 
-        float textScale = 1.0f + 0.1f * feedback_.pulse;
+        float textScale = 1.0f + 0.1f * motion_->feedbackPulse();
         float pivotX = textX + textWidth * 0.5f;
 
         canvas->save();
         canvas->translate(pivotX, centerY);
         canvas->scale(textScale, textScale);
         canvas->translate(-pivotX, -centerY);
-        canvas->drawSimpleText(feedback_.text.c_str(), feedback_.text.size(),
-                               SkTextEncoding::kUTF8, textX, baselineY, font, textPaint);
+        if (label.blob) canvas->drawTextBlob(label.blob, textX, baselineY, textPaint);
         canvas->restore();
 
-        chevrons_.draw(canvas, centerY, static_cast<uint8_t>(alpha), screenWidth, isPortrait);
+        const bool chevrons = chevrons_.draw(canvas, centerY, static_cast<uint8_t>(alpha), screenWidth, isPortrait);
+        stats_->draw(Component::SeekFeedback, (label.blob ? 1 : 0) + (chevrons ? 1 : 0));
     }
 
 private:
-    float dpiScale_;
+    const DpiResources* res_;
+    StatsRecorder* stats_;
+    const MotionRef* motion_;
     SeekFeedback feedback_;
     SeekChevronOverlay chevrons_;
-    sk_sp<SkTypeface> typeface_;
 };
 
 } // namespace skplayer_ui
@@ -1,14 +1,15 @@
 // libs/skplayer_ui/src/SeekPreviewTooltip.h
 #pragma once
 
+#include "DpiResources.h"
 #include "TimeFormat.h"
+#include "StatsRecorder.h"
 #include "Theme.h"
+#include "Trace.h"
 
 #include "include/core/SkCanvas.h"
-#include "include/core/SkFont.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkRRect.h"
-#include "include/core/SkTypeface.h"
 
 #include <array>
 #include <string>
@@ -17,8 +18,9 @@ namespace skplayer_ui {
 
 class SeekPreviewTooltip {
 public:
-    SeekPreviewTooltip(float dpiScale, sk_sp<SkTypeface> typeface)
-        : dpiScale_(std::max(dpiScale, 0.01f)), typeface_(std::move(typeface)) {}
+    SeekPreviewTooltip(const DpiResources& res, StatsRecorder& stats) : res_(&res), stats_(&stats) {}
+
+    void setResources(const DpiResources& res) { res_ = &res; }
 
     void setTime(float seconds) {
         positionSeconds_ = seconds;
@@ -26,7 +28,9 @@ public:
     }
 
     void setChapterName(const std::string& name) {
+        const size_t capacity = chapterName_.capacity();
         chapterName_ = name;
+        if (chapterName_.capacity() != capacity) stats_->add(StatsRecorder::Allocations);
         rebuildDisplayText();
     }
 
@@ -35,15 +39,14 @@ public:
     [[nodiscard]] bool isVisible() const { return visible_; }
 
     void render(SkCanvas* canvas, float centerX, float topY) {
+        SKPLAYER_TRACE_SCOPE("SeekPreviewTooltip::render");
         if (!canvas || !visible_) return;
 
-        const float paddingH = theme::tooltip::kPaddingHorizontalDp * dpiScale_;
-        const float paddingV = theme::tooltip::kPaddingVerticalDp * dpiScale_;
-        const float fontSize = theme::tooltip::kFontSizeDp * dpiScale_;
-
-        SkFont font;
-        font.setSize(fontSize);
-        if (typeface_) font.setTypeface(typeface_);
+        const auto& m = res_->metrics.tooltip;
+        const float paddingH = m.paddingH;
+        const float paddingV = m.paddingV;
+        const float fontSize = m.fontSize;
+        const SkFont& font = res_->tooltipFont;
 
         SkScalar textWidth = font.measureText(displayText_.c_str(), displayText_.size(), SkTextEncoding::kUTF8);
 
@@ -70,20 +73,27 @@ public:
         float textY = topY + paddingV + fontSize * 0.8f;
         canvas->drawSimpleText(displayText_.c_str(), displayText_.size(), SkTextEncoding::kUTF8,
                                textX, textY, font, textPaint);
+
+        // The text is measured above and shaped by drawSimpleText every frame
+        stats_->draw(Component::SeekPreviewTooltip, 2);
+        stats_->add(StatsRecorder::TextMeasurements);
+        stats_->add(StatsRecorder::TextShapings);
     }
 
 private:
     void rebuildDisplayText() {
+        const size_t capacity = displayText_.capacity();
         auto timeView = time_format::formatTime(positionSeconds_, timeTextBuf_);
         displayText_.assign(timeView.data(), timeView.size());
         if (!chapterName_.empty()) {
             displayText_.append("  ");
             displayText_.append(chapterName_);
         }
+        if (displayText_.capacity() != capacity) stats_->add(StatsRecorder::Allocations);
     }
 
-    float dpiScale_;
-    sk_sp<SkTypeface> typeface_;
+    const DpiResources* res_;
+    StatsRecorder* stats_;
     float positionSeconds_ = 0.0f;
     std::string chapterName_;
     bool visible_ = false;
@@ -0,0 +1,88 @@
+// libs/skplayer_ui/src/StatsRecorder.h
+#pragma once
+
+#include "skplayer_ui/ContainerStats.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace skplayer_ui {
+
+// Counters behind VideoContainer::stats(). Only the container's thread
+// writes, so a count is a relaxed load and store (no read-modify-write);
+// any thread may read.
+class StatsRecorder {
+public:
+    enum Counter : uint8_t {
+        Frames,
+        DrawCalls,  // One per Component from here
+        PathsBuilt = DrawCalls + kComponentCount,
+        TextMeasurements,
+        TextShapings,
+        Allocations,
+        StateTransitions,
+        ListenerCallbacks,
+        UpdateNs,
+        RenderNs,
+        CounterCount,
+    };
+
+    static uint64_t nowNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void add(Counter c, uint64_t n = 1) {
+        auto& v = total_[c];
+        v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    void draw(Component c, uint64_t n = 1) { add(static_cast<Counter>(DrawCalls + static_cast<size_t>(c)), n); }
+
+    // Text the blob cache had to shape: measured, shaped and allocated once each
+    void shapedText(uint64_t n) {
+        if (n == 0) return;
+        add(TextMeasurements, n);
+        add(TextShapings, n);
+        add(Allocations, n);
+    }
+
+    // Closes the frame: everything counted since the previous call becomes
+    // the last frame's counts
+    void endFrame() {
+        for (size_t i = 0; i < CounterCount; ++i) {
+            const uint64_t now = total_[i].load(std::memory_order_relaxed);
+            lastFrame_[i].store(now - frameStart_[i], std::memory_order_relaxed);
+            frameStart_[i] = now;
+        }
+    }
+
+    ContainerStats read() const { return {unpack(lastFrame_), unpack(total_)}; }
+
+private:
+    using Values = std::array<std::atomic<uint64_t>, CounterCount>;
+
+    Values total_{};
+    Values lastFrame_{};
+    std::array<uint64_t, CounterCount> frameStart_{};
+
+    static StatsCounters unpack(const Values& v) {
+        auto get = [&v](size_t i) { return v[i].load(std::memory_order_relaxed); };
+        StatsCounters s;
+        s.frames = get(Frames);
+        for (size_t i = 0; i < kComponentCount; ++i) s.drawCalls[i] = get(DrawCalls + i);
+        s.pathsBuilt = get(PathsBuilt);
+        s.textMeasurements = get(TextMeasurements);
+        s.textShapings = get(TextShapings);
+        s.allocations = get(Allocations);
+        s.stateTransitions = get(StateTransitions);
+        s.listenerCallbacks = get(ListenerCallbacks);
+        s.updateNs = get(UpdateNs);
+        s.renderNs = get(RenderNs);
+        return s;
+    }
+};
+
+} // namespace skplayer_ui
@@ -0,0 +1,121 @@
+// libs/skplayer_ui/src/TextBlobCache.h
+#pragma once
+
+#include "include/core/SkFont.h"
+#include "include/core/SkTextBlob.h"
+#include "include/core/SkTypeface.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace skplayer_ui {
+
+// Shaped text plus its advance width (blob bounds are conservative, so the
+// width is measured once at insertion and stored alongside).
+struct CachedText {
+    sk_sp<SkTextBlob> blob;
+    float width = 0.0f;
+};
+
+// Small LRU of text blobs for one font. Intended for short, frequently
+// repeated strings ("+ 10", "1:23", " / 3:14") shared across containers.
+// Linear search is deliberate: capacity is tiny and lookups don't allocate.
+//
+// Internally synchronized, so every method is const. Byte sizes are estimates
+// (SkTextBlob doesn't report its size): per glyph an ID plus a position.
+class TextBlobCache {
+public:
+    explicit TextBlobCache(SkFont font, size_t capacity = 64)
+        : font_(std::move(font)), capacity_(capacity) {}
+
+    SkFont font() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return font_;
+    }
+
+    // Swaps the typeface (e.g. a platform font that finished loading after the
+    // first frame). Blobs shaped with the old one are dropped.
+    void setTypeface(sk_sp<SkTypeface> typeface) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        font_.setTypeface(std::move(typeface));
+        entries_.clear();
+        bytes_ = 0;
+    }
+
+    // `shaped` (if given) is incremented when `text` wasn't cached
+    CachedText get(std::string_view text, uint32_t* shaped = nullptr) const {
+        if (text.empty()) return {};
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++clock_;
+        for (auto& e : entries_) {
+            if (e.key == text) {
+                e.lastUse = clock_;
+                return e.value;
+            }
+        }
+
+        if (shaped) ++*shaped;
+        CachedText value;
+        value.blob = SkTextBlob::MakeFromText(text.data(), text.size(), font_, SkTextEncoding::kUTF8);
+        value.width = font_.measureText(text.data(), text.size(), SkTextEncoding::kUTF8);
+
+        if (entries_.size() >= capacity_) evictOldest();
+        entries_.push_back({std::string(text), value, clock_});
+        bytes_ += EntryBytes(text);
+        while (bytes_ > byteBudget_ && entries_.size() > 1) evictOldest();
+        return value;
+    }
+
+    size_t bytesUsed() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return bytes_;
+    }
+
+    void setByteBudget(size_t bytes) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        byteBudget_ = bytes;
+        while (bytes_ > byteBudget_ && !entries_.empty()) evictOldest();
+    }
+
+    void clear() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+        bytes_ = 0;
+    }
+
+private:
+    struct Entry {
+        std::string key;
+        CachedText value;
+        uint64_t lastUse = 0;
+    };
+
+    static constexpr size_t kBlobOverheadBytes = 64;
+
+    static size_t EntryBytes(std::string_view text) {
+        return sizeof(Entry) + kBlobOverheadBytes + text.size() * (1 + sizeof(uint16_t) + 2 * sizeof(float));
+    }
+
+    void evictOldest() const {
+        auto victim = std::min_element(entries_.begin(), entries_.end(),
+            [](const Entry& a, const Entry& b) { return a.lastUse < b.lastUse; });
+        bytes_ -= EntryBytes(victim->key);
+        *victim = std::move(entries_.back());
+        entries_.pop_back();
+    }
+
+    mutable SkFont font_;
+    size_t capacity_;
+    mutable std::mutex mutex_;
+    mutable std::vector<Entry> entries_;
+    mutable uint64_t clock_ = 0;
+    mutable size_t bytes_ = 0;
+    mutable size_t byteBudget_ = SIZE_MAX;
+};
+
+} // namespace skplayer_ui
@@ -24,6 +24,8 @@ inline constexpr SkColor kTrackBackground = SkColorSetRGB(60, 60, 60);
 inline constexpr SkColor kProgressVisible = SkColorSetRGB(255, 0, 0);    // Red
 inline constexpr SkColor kProgressHidden = SkColorSetRGB(200, 200, 200); // Gray
 
+inline constexpr SkColor kCueMarker = SkColorSetRGB(255, 204, 0);  // Ad break / cue point ticks
+
 } // namespace colors
 
 // Helper: apply alpha to an existing SkColor
@@ -68,6 +70,7 @@ inline constexpr float kTouchExtensionAboveDp = ::skplayer_ui::theme::layout::kS
 inline constexpr float kDragThresholdDp = 8.0f;      // Distance to move before drag-to-seek activates
 inline constexpr float kChapterGapDp = 3.0f;
 inline constexpr float kActiveChapterScale = 1.75f;
+inline constexpr float kCueMarkerWidthDp = 3.0f;
 
 // Landscape mode
 inline constexpr float kLandscapeMarginDp = 48.0f;      // Left/right margin in landscape
@@ -141,9 +144,24 @@ inline constexpr float kOverlayFontSizeDp = 20.4f;  // 15% smaller
 // Timing
 inline constexpr float kPlayPauseAutoHideSeconds = 1.0f;
 inline constexpr float kFeedbackDurationSeconds = 0.8f;
+inline constexpr float kFeedbackFadeOutSeconds = 0.2f;  // Tail of the feedback duration
 
 } // namespace layout
 
+// =============================================================================
+// Animation settling
+// =============================================================================
+
+// Distance from the target below which a smoothed value snaps and counts as
+// settled. Exponential smoothing never reaches its target on its own.
+namespace settle {
+
+inline constexpr float kAlpha = 1.0f / 512.0f;       // Under half an 8-bit alpha step
+inline constexpr float kThumbScale = 1.0f / 256.0f;  // Thumb radius moves < 0.05 px
+inline constexpr float kMorph = 1.0f / 256.0f;       // Icon vertices move < 0.1 px
+
+} // namespace settle
+
 // =============================================================================
 // Gestures
 // =============================================================================
@@ -1,14 +1,15 @@
 // libs/skplayer_ui/src/TimeBadge.h
 #pragma once
 
+#include "DpiResources.h"
 #include "TimeFormat.h"
+#include "StatsRecorder.h"
 #include "Theme.h"
+#include "Trace.h"
 
 #include "include/core/SkCanvas.h"
-#include "include/core/SkFont.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkRRect.h"
-#include "include/core/SkTypeface.h"
 
 #include <array>
 #include <string_view>
@@ -18,8 +19,9 @@ namespace skplayer_ui {
 // Renders the "0:00 / 3:14" time badge above the seek bar
 class TimeBadge {
 public:
-    explicit TimeBadge(float dpiScale = 1.0f, sk_sp<SkTypeface> typeface = nullptr)
-        : dpiScale_(std::max(dpiScale, 0.01f)), typeface_(std::move(typeface)) {}
+    TimeBadge(const DpiResources& res, StatsRecorder& stats) : res_(&res), stats_(&stats) {}
+
+    void setResources(const DpiResources& res) { res_ = &res; }
 
     void update(float currentPosition, float duration) {
         const int cur = static_cast<int>(std::max(0.0f, currentPosition));
@@ -41,18 +43,21 @@ public:
     }
 
     void render(SkCanvas* canvas, float leftX, float topY, float alpha) const {
+        SKPLAYER_TRACE_SCOPE("TimeBadge::render");
         if (alpha < 0.01f) return;
 
-        const float paddingH = theme::timebadge::kPaddingHorizontalDp * dpiScale_;
-        const float paddingV = theme::timebadge::kPaddingVerticalDp * dpiScale_;
-        const float fontSize = theme::timebadge::kFontSizeDp * dpiScale_;
-
-        SkFont font;
-        font.setSize(fontSize);
-        if (typeface_) font.setTypeface(typeface_);
+        const auto& m = res_->metrics.timeBadge;
+        const float paddingH = m.paddingH;
+        const float paddingV = m.paddingV;
+        const float fontSize = m.fontSize;
 
-        const SkScalar leftW = font.measureText(currentView_.data(), currentView_.size(), SkTextEncoding::kUTF8);
-        const SkScalar rightW = font.measureText(rightView_.data(), rightView_.size(), SkTextEncoding::kUTF8);
+        // Both halves repeat across containers and frames; shaped once, shared.
+        uint32_t shaped = 0;
+        const CachedText left = res_->badgeText.get(currentView_, &shaped);
+        const CachedText right = res_->badgeText.get(rightView_, &shaped);
+        stats_->shapedText(shaped);
+        const float leftW = left.width;
+        const float rightW = right.width;
 
         const float badgeW = leftW + rightW + paddingH * 2.0f;
         const float badgeH = fontSize + paddingV * 2.0f;
@@ -76,15 +81,14 @@ public:
 
         const float textX = leftX + paddingH;
         const float textY = topY + paddingV + fontSize * 0.8f;
-        canvas->drawSimpleText(currentView_.data(), currentView_.size(),
-                               SkTextEncoding::kUTF8, textX, textY, font, leftPaint);
-        canvas->drawSimpleText(rightView_.data(), rightView_.size(),
-                               SkTextEncoding::kUTF8, textX + leftW, textY, font, rightPaint);
+        if (left.blob) canvas->drawTextBlob(left.blob, textX, textY, leftPaint);
+        if (right.blob) canvas->drawTextBlob(right.blob, textX + leftW, textY, rightPaint);
+        stats_->draw(Component::TimeBadge, 1 + (left.blob ? 1 : 0) + (right.blob ? 1 : 0));
     }
 
 private:
-    float dpiScale_;
-    sk_sp<SkTypeface> typeface_;
+    const DpiResources* res_;
+    StatsRecorder* stats_;
     int cachedCur_ = -1;
     int cachedDur_ = -1;
     std::array<char, 16> currentText_{};
@@ -0,0 +1,168 @@
+#include "Trace.h"
+
+#if defined(SKPLAYER_UI_TRACING) && SKPLAYER_UI_TRACING
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <unistd.h>
+
+namespace skplayer_ui {
+
+namespace trace {
+
+namespace {
+
+// =============================================================================
+// Per-thread buffers
+// =============================================================================
+//
+// Each thread appends to its own list of fixed-size chunks; only that thread
+// writes, so recording is a store plus a release increment. The exporter
+// reads each chunk's published count with acquire and never sees a partly
+// written event. Chunks are never freed (the data has to outlive threads
+// until exported), and a thread stops recording after kMaxChunks.
+
+struct Event {
+    const char* name;
+    uint64_t ns;
+    char phase;
+};
+
+constexpr size_t kChunkEvents = 8192;
+constexpr size_t kMaxChunks = 128;  // ~1M events per thread
+
+struct Chunk {
+    Event events[kChunkEvents];
+    std::atomic<size_t> count{0};
+    std::atomic<Chunk*> next{nullptr};
+};
+
+struct ThreadBuffer {
+    uint32_t tid = 0;
+    Chunk* head = nullptr;
+    Chunk* tail = nullptr;
+    size_t chunks = 0;
+    std::atomic<uint64_t> dropped{0};
+};
+
+// Buffers of all threads that ever recorded. The mutex is taken once per
+// thread (registration) and by the exporter, never per event.
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+Registry& registry() {
+    static Registry* r = new Registry();  // Leaked: threads may record during exit
+    return *r;
+}
+
+ThreadBuffer* registerThread() {
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->head = buffer->tail = new Chunk();
+    buffer->chunks = 1;
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    buffer->tid = static_cast<uint32_t>(r.buffers.size() + 1);
+    r.buffers.push_back(std::move(buffer));
+    return r.buffers.back().get();
+}
+
+uint64_t nowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// JSON string body; names are code literals, so only quotes and
+// backslashes need escaping
+void writeName(std::FILE* f, const char* name) {
+    for (const char* p = name; *p; ++p) {
+        if (*p == '"' || *p == '\\') std::fputc('\\', f);
+        std::fputc(*p, f);
+    }
+}
+
+} // namespace
+
+void emit(char phase, const char* name) {
+    thread_local ThreadBuffer* buffer = registerThread();
+
+    Chunk* chunk = buffer->tail;
+    size_t n = chunk->count.load(std::memory_order_relaxed);
+    if (n == kChunkEvents) {
+        if (buffer->chunks == kMaxChunks) {
+            buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        Chunk* next = new Chunk();
+        chunk->next.store(next, std::memory_order_release);
+        buffer->tail = chunk = next;
+        ++buffer->chunks;
+        n = 0;
+    }
+    chunk->events[n] = {name, nowNs(), phase};
+    chunk->count.store(n + 1, std::memory_order_release);
+}
+
+} // namespace trace
+
+// =============================================================================
+// Export
+// =============================================================================
+
+bool ExportTrace(const char* path) {
+    std::FILE* f = path ? std::fopen(path, "w") : nullptr;
+    if (!f) return false;
+
+    const int pid = static_cast<int>(::getpid());
+    trace::Registry& r = trace::registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", f);
+    bool first = true;
+    for (const auto& buffer : r.buffers) {
+        std::fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,"
+                        "\"args\":{\"name\":\"skplayer_ui %u\"}}",
+                     first ? "" : ",\n", pid, buffer->tid, buffer->tid);
+        first = false;
+        uint64_t lastNs = 0;
+        for (const trace::Chunk* c = buffer->head; c; c = c->next.load(std::memory_order_acquire)) {
+            const size_t n = c->count.load(std::memory_order_acquire);
+            for (size_t i = 0; i < n; ++i) {
+                const trace::Event& e = c->events[i];
+                lastNs = e.ns;
+                std::fputs(",\n{\"name\":\"", f);
+                trace::writeName(f, e.name);
+                std::fprintf(f, "\",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":%d,\"tid\":%u}", e.phase,
+                             static_cast<unsigned long long>(e.ns / 1000), static_cast<unsigned>(e.ns % 1000),
+                             pid, buffer->tid);
+            }
+        }
+        if (const uint64_t dropped = buffer->dropped.load(std::memory_order_relaxed)) {
+            std::fprintf(f, ",\n{\"name\":\"dropped %llu events (buffer full)\",\"ph\":\"i\",\"s\":\"t\","
+                            "\"ts\":%llu,\"pid\":%d,\"tid\":%u}",
+                         static_cast<unsigned long long>(dropped), static_cast<unsigned long long>(lastNs / 1000),
+                         pid, buffer->tid);
+        }
+    }
+    std::fputs("\n]}\n", f);
+    return std::fclose(f) == 0;
+}
+
+} // namespace skplayer_ui
+
+#else
+
+namespace skplayer_ui {
+
+bool ExportTrace(const char*) { return false; }
+
+} // namespace skplayer_ui
+
+#endif
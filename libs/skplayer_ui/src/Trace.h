@@ -0,0 +1,41 @@
+// libs/skplayer_ui/src/Trace.h
+#pragma once
+
+#include "skplayer_ui/Trace.h"
+
+// SKPLAYER_TRACE_SCOPE("Name") records a begin event here and the matching
+// end event when the enclosing scope exits. Names must be string literals
+// (or otherwise live for the whole process): only the pointer is stored.
+#if defined(SKPLAYER_UI_TRACING) && SKPLAYER_UI_TRACING
+
+#include <cstdint>
+
+namespace skplayer_ui::trace {
+
+// Appends to the calling thread's buffer: no locks, no allocation except
+// a new chunk every few thousand events.
+void emit(char phase, const char* name);
+
+class Scope {
+public:
+    explicit Scope(const char* name) : name_(name) { emit('B', name_); }
+    ~Scope() { emit('E', name_); }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    const char* name_;
+};
+
+} // namespace skplayer_ui::trace
+
+#define SKPLAYER_TRACE_CONCAT_(a, b) a##b
+#define SKPLAYER_TRACE_CONCAT(a, b) SKPLAYER_TRACE_CONCAT_(a, b)
+#define SKPLAYER_TRACE_SCOPE(name) \
+    ::skplayer_ui::trace::Scope SKPLAYER_TRACE_CONCAT(traceScope_, __LINE__)(name)
+
+#else
+
+#define SKPLAYER_TRACE_SCOPE(name) static_cast<void>(0)
+
+#endif
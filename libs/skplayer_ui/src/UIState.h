@@ -24,6 +24,20 @@ enum class UIState {
     Dragging,          // SeekBar thumb drag
 };
 
+// Static names (trace events keep the pointer)
+inline const char* UIStateName(UIState s) {
+    switch (s) {
+        case UIState::Loading:        return "Loading";
+        case UIState::PlayingHidden:  return "PlayingHidden";
+        case UIState::PlayingVisible: return "PlayingVisible";
+        case UIState::PausedVisible:  return "PausedVisible";
+        case UIState::PausedHidden:   return "PausedHidden";
+        case UIState::SeekSession:    return "SeekSession";
+        case UIState::Dragging:       return "Dragging";
+    }
+    return "?";
+}
+
 // =============================================================================
 // Gesture / Overlay State Helpers
 // =============================================================================
@@ -80,29 +94,16 @@ struct SeekBurst {
     }
 };
 
+// The label's content; its timer and pulse are animated (see MotionRef)
 struct SeekFeedback {
     std::string text;
-    float timer = 0;
+    int totalSeconds = 0;
     SeekDirection direction = SeekDirection::Forward;
-    float pulse = 0;
 
-    bool isActive() const { return timer > 0.0f && !text.empty(); }
-
-    void show(int totalSec, float duration) {
+    void show(int totalSec) {
         text = (totalSec > 0 ? "+ " : "- ") + std::to_string(std::abs(totalSec));
-        timer = duration;
+        totalSeconds = totalSec;
         direction = (totalSec < 0) ? SeekDirection::Backward : SeekDirection::Forward;
-        pulse = 1.0f;
-    }
-
-    void update(float dt) {
-        if (timer > 0.0f) {
-            timer -= dt;
-            if (timer <= 0.0f) { timer = 0.0f; text.clear(); }
-        }
-        if (pulse > 0.0f) {
-            pulse = std::max(0.0f, pulse - dt * 10.0f);
-        }
     }
 };
 
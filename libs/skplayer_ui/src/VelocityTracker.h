@@ -0,0 +1,93 @@
+// libs/skplayer_ui/src/VelocityTracker.h
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace skplayer_ui {
+
+// Pointer velocity along one axis from timestamped samples: a least-squares
+// line through the last 100 ms of moves, which rides out the jitter of
+// single event deltas. Used to extrapolate a drag to the time its frame is
+// expected on screen.
+class VelocityTracker {
+public:
+    static constexpr size_t kMaxSamples = 16;
+    static constexpr uint64_t kWindowNs = 100'000'000;   // Older samples don't count
+    static constexpr uint64_t kStaleNs = 50'000'000;     // No move for this long: the pointer stopped
+    static constexpr uint64_t kMaxLeadNs = 33'000'000;   // Never extrapolate past two 60 Hz frames
+
+    // Samples must arrive in time order; a gap longer than the window
+    // (or time going backwards) starts over.
+    void add(float x, uint64_t tNs) {
+        if (count_ > 0 && (tNs < newest().tNs || tNs - newest().tNs > kWindowNs)) reset();
+        samples_[head_] = {x, tNs};
+        head_ = (head_ + 1) % kMaxSamples;
+        count_ = std::min(count_ + 1, kMaxSamples);
+    }
+
+    void reset() {
+        head_ = 0;
+        count_ = 0;
+    }
+
+    [[nodiscard]] bool empty() const { return count_ == 0; }
+
+    // Units per second; 0 until two samples within the window
+    [[nodiscard]] float velocity() const {
+        if (count_ < 2) return 0.0f;
+        const Sample& last = newest();
+
+        // Fit x = a + v * t with t relative to the newest sample
+        double sumT = 0.0, sumX = 0.0;
+        size_t n = 0;
+        for (size_t i = 0; i < count_; ++i) {
+            const Sample& s = at(i);
+            if (last.tNs - s.tNs > kWindowNs) continue;
+            sumT += -static_cast<double>(last.tNs - s.tNs) * 1e-9;
+            sumX += s.x;
+            ++n;
+        }
+        if (n < 2) return 0.0f;
+        const double meanT = sumT / static_cast<double>(n);
+        const double meanX = sumX / static_cast<double>(n);
+
+        double covTX = 0.0, varT = 0.0;
+        for (size_t i = 0; i < count_; ++i) {
+            const Sample& s = at(i);
+            if (last.tNs - s.tNs > kWindowNs) continue;
+            const double dt = -static_cast<double>(last.tNs - s.tNs) * 1e-9 - meanT;
+            covTX += dt * (s.x - meanX);
+            varT += dt * dt;
+        }
+        return varT > 1e-12 ? static_cast<float>(covTX / varT) : 0.0f;
+    }
+
+    // Where the pointer should be at `atNs`: the newest sample carried
+    // forward at the fitted velocity. Stays put once the pointer has stopped.
+    [[nodiscard]] float predict(uint64_t atNs) const {
+        if (count_ == 0) return 0.0f;
+        const Sample& last = newest();
+        if (atNs <= last.tNs || atNs - last.tNs > kStaleNs) return last.x;
+        const uint64_t lead = std::min(atNs - last.tNs, kMaxLeadNs);
+        return last.x + velocity() * static_cast<float>(static_cast<double>(lead) * 1e-9);
+    }
+
+private:
+    struct Sample {
+        float x = 0.0f;
+        uint64_t tNs = 0;
+    };
+
+    // 0 = oldest held
+    const Sample& at(size_t i) const { return samples_[(head_ + kMaxSamples - count_ + i) % kMaxSamples]; }
+    const Sample& newest() const { return at(count_ - 1); }
+
+    std::array<Sample, kMaxSamples> samples_{};
+    size_t head_ = 0;   // Next slot to write
+    size_t count_ = 0;
+};
+
+} // namespace skplayer_ui
@@ -0,0 +1,196 @@
+#include "skplayer_ui/VideoContainerGroup.h"
+#include "MotionLanes.h"
+#include "Trace.h"
+#include "VideoContainerImpl.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace skplayer_ui {
+
+// =============================================================================
+// Impl
+// =============================================================================
+
+class VideoContainerGroup::Impl {
+public:
+    explicit Impl(std::shared_ptr<ResourceContext> ctx)
+        : resources(ctx ? std::move(ctx) : ResourceContext::Make()) {}
+
+    std::shared_ptr<ResourceContext> resources;
+
+    // Slots are address-stable (containers hold a pointer to `woken`).
+    std::vector<std::unique_ptr<VideoContainer>> slots;
+    std::vector<Handle> freeSlots;
+
+    // Animation state of every container, one row each. Rows [0, activeRows)
+    // are the active set stepped by update(); the rest are resting.
+    MotionLanes lanes;
+    std::vector<Handle> rowOwner;  // Container of each row
+    size_t activeRows = 0;
+
+    std::vector<Handle> woken;    // Pushed by containers on input/layout
+    std::vector<Handle> changed;
+    std::vector<Handle> settled;  // Scratch: came to rest during update()
+
+    // Listener callbacks run inside update(); removals they make wait here
+    // until the transition loop is done with the rows and the containers.
+    bool updating = false;
+    std::vector<Handle> pendingRemovals;
+
+    StepClock stepClock;  // Shared dt -> playback microseconds
+
+    uint64_t lastNowMs = 0;
+
+    VideoContainer::Impl& containerImpl(Handle h) { return *slots[h]->impl; }
+
+    // Exchanges rows `a` and `b` and re-points both owners at their new row
+    void swapRows(size_t a, size_t b) {
+        if (a == b) return;
+        lanes.swap(a, b);
+        std::swap(rowOwner[a], rowOwner[b]);
+        containerImpl(rowOwner[a]).motion = MotionRef(&lanes.view(), a);
+        containerImpl(rowOwner[b]).motion = MotionRef(&lanes.view(), b);
+    }
+
+    Handle add(VideoContainer::Config config, VideoContainer::Listener* listener) {
+        if (!config.resources) config.resources = resources;
+
+        Handle h;
+        if (!freeSlots.empty()) {
+            h = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            h = static_cast<Handle>(slots.size());
+            slots.emplace_back();
+        }
+        slots[h] = std::make_unique<VideoContainer>(config, listener);
+
+        // The lanes take over the row the constructor set up (as a resting
+        // row; waking moves it into the active ones)
+        auto& c = containerImpl(h);
+        c.motion = MotionRef(&lanes.view(), lanes.push(c.ownRow));
+        rowOwner.push_back(h);
+
+        c.group.wakeList = &woken;
+        c.group.handle = h;
+        c.wake();  // Step and render at least once
+        return h;
+    }
+
+    void remove(Handle h) {
+        if (h >= slots.size() || !slots[h]) return;
+        if (updating) {
+            if (std::find(pendingRemovals.begin(), pendingRemovals.end(), h) == pendingRemovals.end()) {
+                pendingRemovals.push_back(h);
+            }
+            return;
+        }
+
+        auto dropFrom = [h](std::vector<Handle>& list) {
+            list.erase(std::remove(list.begin(), list.end(), h), list.end());
+        };
+        dropFrom(woken);
+        dropFrom(changed);
+
+        // Its row goes to the end (via the end of the active rows, so those
+        // stay packed) and is dropped
+        size_t row = containerImpl(h).motion.index();
+        if (row < activeRows) swapRows(row, --activeRows);
+        row = containerImpl(h).motion.index();
+        swapRows(row, lanes.size() - 1);
+        lanes.pop();
+        rowOwner.pop_back();
+
+        slots[h].reset();
+        freeSlots.push_back(h);
+    }
+
+    void update(float deltaTimeSeconds, uint64_t nowMs) {
+        SKPLAYER_TRACE_SCOPE("VideoContainerGroup::update");
+        if (updating) return;  // Called from a listener: the outer update steps everyone
+        updating = true;
+
+        const float dt = std::max(deltaTimeSeconds, 0.0f);
+        lastNowMs = std::max(lastNowMs, nowMs);
+
+        // Woken containers join the active rows (`group.active` deduplicates)
+        for (Handle h : woken) swapRows(containerImpl(h).motion.index(), activeRows++);
+        woken.clear();
+        changed.clear();
+
+        const size_t n = activeRows;
+        for (size_t k = 0; k < n; ++k) containerImpl(rowOwner[k]).beginStep(nowMs);
+
+        // One pass over all active rows, in place
+        motion::advance(lanes.view(n), dt, stepClock.step(dt));
+
+        // Apply transitions. Rows don't move in this loop: callbacks that
+        // add containers append resting rows, and removals are deferred.
+        settled.clear();
+        for (size_t k = 0; k < n; ++k) {
+            const Handle h = rowOwner[k];
+            auto& c = containerImpl(h);
+
+            const bool wasTouched = c.touched;
+            c.touched = false;
+            c.endStep();
+
+            // A transition or listener call in endStep() sets `touched`
+            // again; the container then takes another step instead of
+            // resting on what the kernel produced.
+            const bool atRest = !c.touched && c.isAtRest();
+            if (c.motion.changed() > 0.0f || wasTouched || c.touched) changed.push_back(h);
+            c.touched = false;
+
+            if (atRest) {
+                c.group.active = false;
+                settled.push_back(h);
+            }
+        }
+
+        // Retire: swap each settled row past the end of the active ones. A
+        // container woken again by a later callback rejoins next update().
+        for (Handle h : settled) swapRows(containerImpl(h).motion.index(), --activeRows);
+
+        updating = false;
+        for (Handle h : pendingRemovals) remove(h);
+        pendingRemovals.clear();
+    }
+
+    // Resting containers have no deadline, so only the active set matters.
+    uint64_t nextDeadlineMs() const {
+        if (!woken.empty()) return lastNowMs;
+        uint64_t earliest = VideoContainer::kNoDeadline;
+        for (size_t k = 0; k < activeRows; ++k) {
+            earliest = std::min(earliest, slots[rowOwner[k]]->impl->nextDeadlineMs());
+            if (earliest <= lastNowMs) break;
+        }
+        return earliest;
+    }
+};
+
+// =============================================================================
+// VideoContainerGroup public interface
+// =============================================================================
+
+VideoContainerGroup::VideoContainerGroup(std::shared_ptr<ResourceContext> resources)
+    : impl(std::make_unique<Impl>(std::move(resources))) {}
+
+VideoContainerGroup::~VideoContainerGroup() = default;
+
+VideoContainerGroup::Handle VideoContainerGroup::add(VideoContainer::Config config,
+                                                     VideoContainer::Listener* listener) {
+    return impl->add(std::move(config), listener);
+}
+
+void VideoContainerGroup::remove(Handle handle) { impl->remove(handle); }
+VideoContainer& VideoContainerGroup::container(Handle handle) { return *impl->slots[handle]; }
+size_t VideoContainerGroup::size() const { return impl->slots.size() - impl->freeSlots.size(); }
+size_t VideoContainerGroup::activeCount() const { return impl->activeRows + impl->woken.size(); }
+void VideoContainerGroup::update(float dt, uint64_t nowMs) { impl->update(dt, nowMs); }
+uint64_t VideoContainerGroup::nextDeadlineMs() const { return impl->nextDeadlineMs(); }
+const std::vector<VideoContainerGroup::Handle>& VideoContainerGroup::changed() const { return impl->changed; }
+void VideoContainerGroup::render(Handle handle, SkCanvas* canvas) { impl->slots[handle]->render(canvas); }
+
+} // namespace skplayer_ui
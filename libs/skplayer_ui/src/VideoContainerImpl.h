@@ -0,0 +1,741 @@
+// libs/skplayer_ui/src/VideoContainerImpl.h
+#pragma once
+
+#include "skplayer_ui/VideoContainer.h"
+#include "AnimationScheduler.h"
+#include "ContainerLayout.h"
+#include "DpiResources.h"
+#include "FrameRatePolicy.h"
+#include "LatencyTracker.h"
+#include "LiveBadge.h"
+#include "MotionLanes.h"
+#include "PlayPauseButton.h"
+#include "SeekBar.h"
+#include "SeekPreviewTooltip.h"
+
+#include "UIState.h"
+#include "TimeBadge.h"
+#include "SeekFeedbackOverlay.h"
+#include "StatsRecorder.h"
+#include "Trace.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkRect.h"
+#include "include/core/SkTypeface.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace skplayer_ui {
+
+// =============================================================================
+// Impl
+// =============================================================================
+
+class VideoContainer::Impl {
+public:
+    Impl(std::shared_ptr<ResourceContext> ctx, float dpi)
+        : resources(std::move(ctx))
+        , res(&resources->forDpi(dpi))
+        , seekBar(*res, stats, motion)
+        , playPauseButton(*res, stats, motion)
+        , seekPreviewTooltip(*res, stats)
+        , timeBadge(*res, stats)
+        , liveBadge(*res, stats)
+        , seekFeedback(*res, stats, motion) {}
+
+    Listener* listener = nullptr;
+
+    // Shared resources (kept alive by `resources`)
+    std::shared_ptr<ResourceContext> resources;
+    const DpiResources* res;
+
+    // Layout inputs and the cached result of the layout pass
+    float width = 0;
+    float height = 0;
+    bool isPortrait = false;
+    float videoCenterY = 0.0f;
+    ContainerLayout layout;
+
+    // Counters behind stats(), shared with the components
+    StatsRecorder stats;
+
+    // Animation state. Everything the kernel steps is read and written
+    // through `motion`: the container's own row, or its row in the group's
+    // lanes while it is grouped (see VideoContainerGroup).
+    MotionRow ownRow;
+    MotionLanesView ownLanes = MotionLanesView::Of(ownRow);
+    MotionRef motion{&ownLanes, 0};
+
+    // Components
+    SeekBar seekBar;
+    SeekBarState state;
+    PlayPauseButton playPauseButton;
+    SeekPreviewTooltip seekPreviewTooltip;
+    TimeBadge timeBadge;
+    LiveBadge liveBadge;
+    SeekFeedbackOverlay seekFeedback;
+
+    // State machine
+    UIState uiState = UIState::Loading;
+    bool returnToPlaying = true;  // Resume playing after drag/seek session ends
+
+    // Gesture state
+    TapGesture tap;
+    SeekBurst burst;
+
+    // Live/DVR: state.windowStart/duration are the seekable range, set by
+    // the host; playback at the edge follows it instead of advancing.
+    bool live = false;
+    bool followLive = false;
+
+    // Scheduling
+    StepClock stepClock;      // update() dt -> playback microseconds
+    uint64_t lastNowMs = 0;   // Host clock at the last step
+    bool touched = false;     // Input, layout or a state change since the last step
+    FrameRatePolicy frameRate;
+
+    // Input-to-photon latency: created by the first timestamped input, so
+    // hosts that don't pass timestamps pay nothing
+    std::unique_ptr<LatencyTracker> latency;
+    uint64_t inputNs = 0;     // Timestamp of the event being handled, 0 = none
+
+    // =========================================================================
+    // State queries
+    // =========================================================================
+
+    bool isPlaying() const {
+        return uiState == UIState::PlayingHidden || uiState == UIState::PlayingVisible;
+    }
+
+    bool isPlayPauseShown() const {
+        return !state.isLoading &&
+               (uiState == UIState::PausedVisible || uiState == UIState::PlayingVisible);
+    }
+
+    // =========================================================================
+    // State transitions
+    // =========================================================================
+
+    void transitionTo(UIState newState) {
+        if (uiState == newState) return;
+        SKPLAYER_TRACE_SCOPE("transitionTo");
+        SKPLAYER_TRACE_SCOPE(UIStateName(newState));
+        stats.add(StatsRecorder::StateTransitions);
+        uiState = newState;
+        applyUIState();
+        touched = true;
+    }
+
+    // Derives the components' state from uiState on entering it
+    void applyUIState() {
+        const UIState newState = uiState;
+
+        // Derive control visibility from state
+        bool showControls = (newState == UIState::PlayingVisible ||
+                             newState == UIState::PausedVisible ||
+                             newState == UIState::SeekSession ||
+                             newState == UIState::Dragging);
+
+        // Derive playing status from state
+        // SeekSession: use returnToPlaying since playback will resume based on that
+        bool playing = (newState == UIState::PlayingHidden ||
+                        newState == UIState::PlayingVisible ||
+                        (newState == UIState::SeekSession && returnToPlaying));
+
+        showControls ? seekBar.expand() : seekBar.collapse();
+        playPauseButton.setPlaying(playing);
+        motion.autoHide() = (newState == UIState::PlayingVisible)
+                            ? theme::layout::kPlayPauseAutoHideSeconds : 0.0f;
+
+        if (newState == UIState::Dragging) seekPreviewTooltip.show();
+    }
+
+    void play() {
+        // Restart from beginning if at end (a live stream has no end)
+        if (!live && state.currentPosition >= state.duration) {
+            state.currentPosition = 0;
+            state.cues.seek(0);
+            seekBar.setState(state);
+            notifySeek();
+        }
+        if (Listener* l = notify()) l->onPlay();
+        transitionTo(UIState::PlayingVisible);
+    }
+
+    void pause() {
+        followLive = false;
+        if (Listener* l = notify()) l->onPause();
+        transitionTo(UIState::PausedVisible);
+    }
+
+    void togglePlayPause() {
+        if (isPlaying()) pause();
+        else play();
+    }
+
+    // =========================================================================
+    // Helpers
+    // =========================================================================
+
+    bool canSeekBy(int deltaSec) const {
+        if (deltaSec > 0) return state.currentPosition < state.windowEnd();
+        if (deltaSec < 0) return state.currentPosition > state.windowStart;
+        return true;
+    }
+
+    // The listener, counted as a callback fired; null if none
+    Listener* notify() {
+        if (listener) stats.add(StatsRecorder::ListenerCallbacks);
+        return listener;
+    }
+
+    // Listener edge: exact microseconds (the default forwards float seconds)
+    void notifySeek() {
+        if (Listener* l = notify()) l->onSeekToUs(state.currentPosition);
+    }
+
+    // Moves the position (clamped to the window) and picks the live edge
+    // back up when it lands there.
+    void setPosition(MediaTimeUs position) {
+        state.currentPosition = std::clamp(position, state.windowStart, state.windowEnd());
+        followLive = live && state.currentPosition >= state.windowEnd();
+        state.cues.seek(state.currentPosition);
+        seekBar.setState(state);
+    }
+
+    void performSeek(int deltaSec) {
+        setPosition(state.currentPosition + deltaSec * media_time::kPerSecond);
+        seekBar.expand();
+        notifySeek();
+    }
+
+    void setChapters(std::vector<Chapter> chapters) {
+        state.chapters.assign(std::move(chapters));
+        if (live) state.chapters.expireBefore(state.windowStart);
+        seekBar.setState(state);
+        if (seekPreviewTooltip.isVisible()) updateTooltipContent(seekBar.getPreviewPosition());
+    }
+
+    void setCuePoints(std::vector<CuePoint> cues) {
+        state.cues.assign(std::move(cues), state.currentPosition);
+        seekBar.setState(state);
+    }
+
+    // Playback moved forward from where the cursor was: report the cues it
+    // passed. Jumps go through setPosition() (or cues.seek) instead.
+    void fireCues() {
+        state.cues.advanceTo(state.currentPosition, [this](const CuePoint& cue) {
+            if (Listener* l = notify()) l->onCuePoint(cue);
+        });
+    }
+
+    bool appendChapter(Chapter chapter) {
+        if (!state.chapters.append(std::move(chapter))) return false;
+        if (seekPreviewTooltip.isVisible()) updateTooltipContent(seekBar.getPreviewPosition());
+        return true;
+    }
+
+    // =========================================================================
+    // Live window
+    // =========================================================================
+
+    void setLiveWindow(MediaTimeUs start, MediaTimeUs end) {
+        if (!live) followLive = true;  // Live streams open at the edge
+        live = true;
+        state.windowStart = std::max<MediaTimeUs>(0, start);
+        state.duration = std::max<MediaTimeUs>(0, end - state.windowStart);
+        state.chapters.expireBefore(state.windowStart);
+
+        if (followLive) {
+            state.currentPosition = state.windowEnd();
+            fireCues();
+        } else if (state.currentPosition < state.windowStart) {
+            // Paused (or behind) so long that the window slid past us
+            state.currentPosition = state.windowStart;
+            state.cues.seek(state.currentPosition);
+            notifySeek();
+        }
+        seekBar.setState(state);
+    }
+
+    void jumpToLive() {
+        if (!live) return;
+        setPosition(state.windowEnd());
+        notifySeek();
+        burst.reset();
+        if (!isPlaying()) play();
+        seekBar.expand();
+    }
+
+    bool isAtLiveEdge() const { return live && followLive; }
+
+    // By reference: a drag asks on every move
+    const std::string& getChapterNameAtPosition(MediaTimeUs pos) const {
+        static const std::string kNoChapter;
+        if (state.chapters.empty() || state.duration <= 0) return kNoChapter;
+        const int i = state.chapters.indexAt(pos);
+        return state.chapters[i < 0 ? 0 : static_cast<size_t>(i)].title;
+    }
+
+    void updateTooltipContent(MediaTimeUs pos) {
+        seekPreviewTooltip.setTime(static_cast<float>(media_time::toSeconds(pos)));
+        seekPreviewTooltip.setChapterName(getChapterNameAtPosition(pos));
+    }
+
+    // =========================================================================
+    // Pointer event helpers
+    // =========================================================================
+
+    // Files the event being handled under `kind`, to be timed to the next
+    // presented frame
+    void noteInteraction(Interaction kind) {
+        if (inputNs == 0) return;
+        if (!latency) latency = std::make_unique<LatencyTracker>();
+        latency->note(kind, inputNs);
+    }
+
+    // Regions that currently accept input (the button only while it is drawn)
+    uint32_t enabledHitRegions() const {
+        uint32_t enabled = HitMap::Bit(HitRegion::SeekBar) | HitMap::Bit(HitRegion::Video);
+        if (isPlayPauseShown()) enabled |= HitMap::Bit(HitRegion::PlayPause);
+        return enabled;
+    }
+
+    bool trySeekBarDrag(float x, float y) {
+        auto seekEvent = seekBar.onTouchDown(x, y, inputNs);
+        if (seekEvent.type == SeekBar::SeekEvent::Type::Started) {
+            handleSeekStarted();
+            burst.reset();
+            return true;
+        }
+        return false;
+    }
+
+    void pressPlayPauseButton() {
+        playPauseButton.startRipple();
+        togglePlayPause();
+        burst.reset();
+    }
+
+    bool tryBurstContinuation(SeekDirection dir, uint64_t nowMs) {
+        if (!burst.canContinue(dir, nowMs)) return false;
+
+        int step = 10 * static_cast<int>(dir);
+        if (!canSeekBy(step)) {
+            burst.reset();
+            return true;  // Consumed the tap, just can't seek further
+        }
+        burst.accumulate(step, nowMs);
+        performSeek(step);
+        seekFeedback.show(burst.totalSeconds);
+        return true;
+    }
+
+    bool tryDoubleTapSeek(float x, float y, SeekDirection dir, uint64_t nowMs, bool force) {
+        if (!force && !tap.isDoubleTap(x, y, nowMs, res->metrics.doubleTapDistance)) {
+            return false;
+        }
+
+        int step = 10 * static_cast<int>(dir);
+        if (!canSeekBy(step)) return false;
+
+        performSeek(step);
+        burst.start(dir, step, nowMs);
+
+        if (uiState != UIState::SeekSession) {
+            returnToPlaying = isPlaying();
+            transitionTo(UIState::SeekSession);
+        }
+
+        seekFeedback.show(burst.totalSeconds);
+        tap.reset();
+        return true;
+    }
+
+    void handleSingleTap(float x, float y, uint64_t nowMs) {
+        // In SeekSession, use returnToPlaying since isPlaying() returns false
+        bool wasPlaying = (uiState == UIState::SeekSession) ? returnToPlaying : isPlaying();
+        
+        if (wasPlaying) {
+            transitionTo(UIState::PlayingVisible);
+        } else {
+            transitionTo(uiState == UIState::PausedHidden ? UIState::PausedVisible : UIState::PausedHidden);
+        }
+        burst.reset();
+        tap.record(x, y, nowMs);
+    }
+
+    // =========================================================================
+    // Update helpers
+    // =========================================================================
+
+    void updateBurstState(uint64_t nowMs) {
+        if (burst.isTimedOut(nowMs)) {
+            burst.reset();
+        }
+        seekFeedback.setBurstActive(burst.active);
+    }
+
+    void updateSeekSession() {
+        if (uiState == UIState::SeekSession && !burst.active &&
+            !seekFeedback.isAnimating() && !seekFeedback.isActive()) {
+            transitionTo(returnToPlaying ? UIState::PlayingHidden : UIState::PausedVisible);
+        }
+    }
+
+    void updatePlayback() {
+        if (motion.positionRate() <= 0) return;
+
+        fireCues();
+
+        if (live) {
+            // Caught up with the edge: follow it from here on
+            if (state.currentPosition >= state.windowEnd()) setPosition(state.windowEnd());
+            return;
+        }
+        if (state.currentPosition >= state.duration) {
+            state.currentPosition = state.duration;
+            seekBar.setPosition(state.currentPosition);
+            transitionTo(UIState::PausedVisible);
+            if (Listener* l = notify()) l->onPause();
+        }
+    }
+
+    void updateAutoHide() {
+        if (motion.autoHideActive() > 0.0f && motion.autoHide() <= 0.0f && uiState == UIState::PlayingVisible) {
+            transitionTo(UIState::PlayingHidden);
+        }
+    }
+
+    void updateLoading() {
+        if (motion.loadingActive() <= 0.0f || !state.isLoading) return;
+
+        if (motion.loadingRemaining() <= 0.0f) {
+            motion.loadingRemaining() = 0.0f;
+            state.isLoading = false;
+            seekBar.setState(state);
+            if (Listener* l = notify()) l->onPlay();
+            transitionTo(UIState::PlayingHidden);
+        }
+    }
+
+    // =========================================================================
+    // Stepping
+    // =========================================================================
+    //
+    // One update is: beginStep (discrete, clock-driven) -> motion::advance
+    // (continuous, branch-free, on the `motion` row in place) -> endStep
+    // (transitions triggered by the new values). Standalone containers step
+    // their own row; VideoContainerGroup steps all its active rows at once.
+
+    void beginStep(uint64_t nowMs) {
+        lastNowMs = std::max(lastNowMs, nowMs);
+        updateBurstState(nowMs);
+        writeMotionInputs();
+    }
+
+    // Kernel inputs derived from the state machine. Position is owned by
+    // `state` (seeks, cues and snapshots use it): the row gets a copy here
+    // and hands it back in endStep() while playback advances it.
+    void writeMotionInputs() {
+        seekBar.writeMotionInputs(isPlaying());
+        motion.position() = state.currentPosition;
+        motion.positionRate() = (isPlaying() && !burst.active && !followLive) ? 1 : 0;
+        motion.duration() = state.windowEnd();  // Where playback stops advancing
+        motion.autoHideActive() = (uiState == UIState::PlayingVisible && motion.autoHide() > 0.0f) ? 1.0f : 0.0f;
+    }
+
+    void endStep() {
+        if (motion.positionRate() > 0) {
+            state.currentPosition = motion.position();
+            seekBar.setPosition(state.currentPosition);
+        }
+        updateSeekSession();
+        updatePlayback();
+        updateAutoHide();
+        updateLoading();
+        seekBar.syncVisibility(isPlaying());
+        writeMotionInputs();  // For nextDeadlineMs() and the group's rest check
+        frameRate.update(wantedFrameRate(), lastNowMs);
+    }
+
+    // =========================================================================
+    // Scheduling
+    // =========================================================================
+
+    FrameRateMode wantedFrameRate() const {
+        if (uiState == UIState::Dragging || uiState == UIState::SeekSession || burst.active) {
+            return FrameRateMode::Max;
+        }
+        if (isPlaying()) return FrameRateMode::Content;
+        return motion::isSettled(motion) ? FrameRateMode::Idle : FrameRateMode::Low;
+    }
+
+    void collectDeadlines(DeadlineSet& d) const {
+        motion::collectDeadlines(motion, d);
+        frameRate.collectDeadlines(d);
+
+        // Burst ends (and the seek session with it) once the tap window lapses
+        if (burst.active) {
+            d.at(burst.lastTapTime + theme::gesture::kSeekBurstContinueThresholdMs + 1);
+        }
+
+        // Playback only needs a frame when progress moves by a pixel (or
+        // reaches the end and pauses); hidden landscape controls draw nothing.
+        if (motion.positionRate() > 0) {
+            MediaTimeUs step = motion.duration() - motion.position();
+            bool progressVisible = isPortrait || motion.controlsAlpha() > 0.01f;
+            if (progressVisible && width > 0.0f) step = std::min(step, state.duration / std::max<MediaTimeUs>(1, static_cast<MediaTimeUs>(width)));
+            d.afterUs(step);
+        }
+    }
+
+    uint64_t nextDeadlineMs() const {
+        DeadlineSet d(lastNowMs);
+        if (touched) d.frameNow();
+        collectDeadlines(d);
+        return d.earliest();
+    }
+
+    // True when nothing would change on the next step without new input.
+    bool isAtRest() const {
+        DeadlineSet d(lastNowMs);
+        collectDeadlines(d);
+        return d.empty();
+    }
+
+    // =========================================================================
+    // Group membership (see VideoContainerGroup)
+    // =========================================================================
+
+    struct GroupLink {
+        std::vector<uint32_t>* wakeList = nullptr;
+        uint32_t handle = 0;
+        bool active = false;      // Currently in the group's active set
+    } group;
+
+    // Called on input and layout changes so a resting grouped container is
+    // stepped (and re-rendered) again.
+    void wake() {
+        touched = true;
+        if (group.wakeList && !group.active) {
+            group.active = true;
+            group.wakeList->push_back(group.handle);
+        }
+    }
+
+    // =========================================================================
+    // Event handlers
+    // =========================================================================
+
+    void handleSeekStarted() {
+        returnToPlaying = isPlaying();
+        followLive = false;  // Re-evaluated where the drag ends
+        transitionTo(UIState::Dragging);
+        updateTooltipContent(seekBar.getPreviewPosition());
+        if (Listener* l = notify()) l->onPause();
+    }
+
+    void handleSeekCompleted(MediaTimeUs position) {
+        setPosition(position);
+        seekPreviewTooltip.hide();
+
+        if (returnToPlaying) {
+            if (Listener* l = notify()) l->onPlay();
+            transitionTo(UIState::PlayingVisible);
+        } else {
+            transitionTo(UIState::PausedVisible);
+        }
+        notifySeek();
+    }
+
+    void onPointerDown(float x, float y, uint64_t nowMs, bool forceDoubleTap, uint64_t eventNs) {
+        SKPLAYER_TRACE_SCOPE("onPointerDown");
+        inputNs = eventNs;
+        if (state.isLoading) return;
+
+        // The live badge sits where the time badge is drawn (not in the hit map)
+        if (live && liveBadge.contains(x, y)) {
+            jumpToLive();
+            noteInteraction(Interaction::Tap);
+            return;
+        }
+
+        // Z-ordered: seek bar, then play/pause, then the video surface. A
+        // touch on the bar that doesn't start a drag still counts as a tap.
+        const HitRegion region = layout.hits.hit(x, y, enabledHitRegions());
+        if (region == HitRegion::None) return;
+
+        if (region == HitRegion::SeekBar && trySeekBarDrag(x, y)) {
+            noteInteraction(Interaction::DragMove);
+            return;
+        }
+        if (region == HitRegion::PlayPause) {
+            pressPlayPauseButton();
+            noteInteraction(Interaction::PlayPause);
+            return;
+        }
+
+        SeekDirection dir = (x < width * 0.5f) ? SeekDirection::Backward : SeekDirection::Forward;
+
+        if (tryBurstContinuation(dir, nowMs)) {
+            noteInteraction(Interaction::DoubleTapSeek);
+            return;
+        }
+
+        // Reset stale burst if direction changed
+        if (burst.active && !burst.canContinue(dir, nowMs)) {
+            burst.reset();
+        }
+
+        if (tryDoubleTapSeek(x, y, dir, nowMs, forceDoubleTap)) {
+            noteInteraction(Interaction::DoubleTapSeek);
+            return;
+        }
+
+        handleSingleTap(x, y, nowMs);
+        noteInteraction(Interaction::Tap);
+    }
+
+    void onPointerMove(float x, float y, uint64_t eventNs) {
+        SKPLAYER_TRACE_SCOPE("onPointerMove");
+        inputNs = eventNs;
+        if (state.isLoading) return;
+
+        auto seekEvent = seekBar.onTouchMove(x, y, inputNs);
+        if (seekEvent.type == SeekBar::SeekEvent::Type::Started) {
+            handleSeekStarted();
+            burst.reset();
+        }
+
+        if (uiState == UIState::Dragging) {
+            updateTooltipContent(seekBar.getPreviewPosition());
+            noteInteraction(Interaction::DragMove);
+        }
+    }
+
+    void onPointerUp(float x, float y, uint64_t eventNs) {
+        SKPLAYER_TRACE_SCOPE("onPointerUp");
+        inputNs = eventNs;
+        if (state.isLoading) return;
+
+        auto seekEvent = seekBar.onTouchUp(x, y);
+        if (seekEvent.type == SeekBar::SeekEvent::Type::Completed) {
+            handleSeekCompleted(seekEvent.position);
+            noteInteraction(Interaction::DragMove);
+        }
+    }
+
+    void update(float deltaTimeSeconds, uint64_t nowMs) {
+        SKPLAYER_TRACE_SCOPE("update");
+        const uint64_t startNs = StatsRecorder::nowNs();
+        float dt = std::max(deltaTimeSeconds, 0.0f);
+
+        beginStep(nowMs);
+        motion::advance(motion.row(), dt, stepClock.step(dt));
+        endStep();
+        touched = false;
+        stats.add(StatsRecorder::UpdateNs, StatsRecorder::nowNs() - startNs);
+    }
+
+    // Drag preview (thumb and tooltip) extrapolated to the frame's expected
+    // present time. Keeps frames coming while the preview is off the touch,
+    // so it settles back once the pointer stops.
+    void predictPointer(uint64_t presentNs) {
+        if (uiState != UIState::Dragging) return;
+        if (seekBar.predictPreview(presentNs)) updateTooltipContent(seekBar.getPreviewPosition());
+        if (seekBar.isPreviewPredicted()) wake();
+    }
+
+    void render(SkCanvas* canvas) {
+        if (!canvas || width <= 0 || height <= 0) return;
+        SKPLAYER_TRACE_SCOPE("render");
+        const uint64_t startNs = StatsRecorder::nowNs();
+        if (latency) latency->rendered();  // This frame reflects all input so far
+
+        drawComponents(canvas);
+
+        stats.add(StatsRecorder::Frames);
+        stats.add(StatsRecorder::RenderNs, StatsRecorder::nowNs() - startNs);
+        stats.endFrame();
+    }
+
+    void drawComponents(SkCanvas* canvas) {
+        const ContainerLayout& l = layout;
+        seekBar.render(canvas);
+
+        float controlsAlpha = seekBar.alpha();
+
+        // Time badge, or the live badge in its place
+        if (!state.isLoading && uiState != UIState::Dragging &&
+            !seekPreviewTooltip.isVisible() && controlsAlpha > 0.01f && state.duration > 0) {
+            if (live) {
+                const MediaTimeUs behind = followLive ? 0 : state.windowEnd() - state.currentPosition;
+                liveBadge.update(static_cast<float>(media_time::toSeconds(behind)));
+                liveBadge.render(canvas, l.badgeLeft, l.badgeTop, controlsAlpha);
+            } else {
+                timeBadge.update(static_cast<float>(media_time::toSeconds(state.currentPosition)),
+                                 static_cast<float>(media_time::toSeconds(state.duration)));
+                timeBadge.render(canvas, l.badgeLeft, l.badgeTop, controlsAlpha);
+            }
+        } else {
+            liveBadge.hide();
+        }
+
+        // Play/pause button
+        if (isPlayPauseShown()) {
+            playPauseButton.render(canvas, l.playPauseButton, controlsAlpha);
+        }
+
+        // Seek preview tooltip
+        if (seekPreviewTooltip.isVisible()) {
+            seekPreviewTooltip.render(canvas, l.tooltipCenterX, l.tooltipY);
+        }
+
+        // Seek feedback overlay
+        if (seekFeedback.isActive()) {
+            seekFeedback.render(canvas, videoCenterY, width, isPortrait);
+        }
+    }
+
+    // =========================================================================
+    // Layout pass (viewport, orientation or DPI changes only)
+    // =========================================================================
+
+    void relayout() {
+        layout = ContainerLayout::Compute(res->metrics, width, height, isPortrait, videoCenterY);
+        seekBar.setGeometry(layout.seekBar);
+    }
+
+    void setViewport(int w, int h) {
+        width = static_cast<float>(w);
+        height = static_cast<float>(h);
+        playPauseButton.setPlaying(isPlaying());
+        relayout();
+    }
+
+    void setLayout(bool portrait, float vidCenterY) {
+        isPortrait = portrait;
+        videoCenterY = vidCenterY;
+        seekBar.setPortraitMode(portrait);
+        relayout();
+    }
+
+    void setDpiScale(float dpi) {
+        const DpiResources* next = &resources->forDpi(dpi);
+        if (next == res) return;
+        res = next;
+        seekBar.setResources(*res);
+        playPauseButton.setResources(*res);
+        seekPreviewTooltip.setResources(*res);
+        timeBadge.setResources(*res);
+        liveBadge.setResources(*res);
+        seekFeedback.setResources(*res);
+        relayout();
+    }
+};
+
+} // namespace skplayer_ui
@@ -0,0 +1,316 @@
+#include "skplayer_ui/VideoContainer.h"
+#include "VideoContainerImpl.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace skplayer_ui {
+
+namespace {
+
+// =============================================================================
+// Format
+// =============================================================================
+//
+//   Header
+//   Core
+//   ContainerLayout                       raw; adopted when the DPI matches
+//   int64   chapterStartUs[chapterCount]
+//   int64   cueTimeUs[cueCount]
+//   float   chapterStartSeconds[chapterCount]
+//   CuePoint cues[cueCount]
+//   uint32  titleEnd[chapterCount]        end offsets into the title bytes
+//   char    titles[titleBytes]
+//
+// Native byte order and struct layout, like the app's other caches: a
+// snapshot is for the same build on the same device (saved instance state),
+// not an exchange format. Restoring copies arrays out; nothing is parsed.
+
+constexpr char kMagic[4] = {'S', 'K', 'V', 'S'};
+constexpr uint32_t kFormatVersion = 2;
+
+struct Header {
+    char magic[4];
+    uint32_t formatVersion;
+    uint32_t layoutBytes;  // sizeof(ContainerLayout) in the writing build
+    uint32_t chapterCount;
+    uint32_t titleBytes;
+    uint32_t cueCount;
+    uint64_t totalBytes;
+    uint64_t checksum;     // Checksum() of everything after the header
+};
+
+enum CoreFlags : uint8_t {
+    kReturnToPlaying = 1 << 0,
+    kLive = 1 << 1,
+    kFollowLive = 1 << 2,
+    kLoading = 1 << 3,
+    kPortrait = 1 << 4,
+    kBurstActive = 1 << 5,
+};
+
+struct Core {
+    MediaTimeUs duration;
+    MediaTimeUs windowStart;
+    MediaTimeUs currentPosition;
+    float autoHideTimer;
+    float loadingSecondsRemaining;
+    float width;
+    float height;
+    float videoCenterY;
+    float dpiScale;
+    float feedbackTimer;
+    int32_t feedbackSeconds;
+    int32_t burstSeconds;
+    uint32_t burstAgeMs;   // Since the burst's last tap; host clocks don't survive a restart
+    uint8_t uiState;
+    uint8_t flags;
+    int8_t burstDirection;
+    uint8_t reserved[5];   // Zero; pads to 8 bytes
+};
+
+// FNV-1a over 8-byte words (bytes for the tail): a corruption check that
+// keeps up with memcpy, where byte-wise FNV would cost as much as parsing.
+uint64_t Checksum(const uint8_t* p, size_t size) {
+    uint64_t h = 1469598103934665603ull;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, p + i, sizeof(word));
+        h = (h ^ word) * 1099511628211ull;
+    }
+    for (; i < size; ++i) h = (h ^ p[i]) * 1099511628211ull;
+    return h;
+}
+
+static_assert(std::is_trivially_copyable_v<ContainerLayout>, "Layout is stored as raw bytes");
+static_assert(std::is_trivially_copyable_v<CuePoint>, "Cues are stored as raw bytes");
+
+class Writer {
+public:
+    explicit Writer(std::vector<uint8_t>& out) : out_(out) {}
+    void put(const void* data, size_t size) {
+        if (size == 0) return;
+        std::memcpy(out_.data() + at_, data, size);
+        at_ += size;
+    }
+private:
+    std::vector<uint8_t>& out_;
+    size_t at_ = 0;
+};
+
+// Bounds-checked cursor over the input; take() fails once past the end.
+class Reader {
+public:
+    Reader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+    bool take(void* dst, size_t size) {
+        if (size > size_ - at_) return false;
+        if (size > 0) std::memcpy(dst, data_ + at_, size);
+        at_ += size;
+        return true;
+    }
+    template <typename T>
+    bool takeArray(std::vector<T>& dst, size_t count) {
+        if (count > (size_ - at_) / sizeof(T)) return false;
+        dst.resize(count);
+        return take(dst.data(), count * sizeof(T));
+    }
+    // The next `size` bytes in place, or nullptr past the end
+    const uint8_t* view(size_t size) {
+        if (size > size_ - at_) return nullptr;
+        const uint8_t* p = data_ + at_;
+        at_ += size;
+        return p;
+    }
+    const uint8_t* peek() const { return data_ + at_; }
+    size_t remaining() const { return size_ - at_; }
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t at_ = 0;
+};
+
+} // namespace
+
+// =============================================================================
+// Snapshot
+// =============================================================================
+
+std::vector<uint8_t> VideoContainer::snapshot() const {
+    const Impl& c = *impl;
+    const ChapterTrack& chapters = c.state.chapters;
+    const CueTrack& cues = c.state.cues;
+
+    size_t titleBytes = 0;
+    for (size_t i = 0; i < chapters.size(); ++i) titleBytes += chapters[i].title.size();
+
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.formatVersion = kFormatVersion;
+    header.layoutBytes = sizeof(ContainerLayout);
+    header.chapterCount = static_cast<uint32_t>(chapters.size());
+    header.titleBytes = static_cast<uint32_t>(titleBytes);
+    header.cueCount = static_cast<uint32_t>(cues.size());
+    header.totalBytes = sizeof(Header) + sizeof(Core) + sizeof(ContainerLayout) +
+                        chapters.size() * (sizeof(int64_t) + sizeof(float) + sizeof(uint32_t)) + titleBytes +
+                        cues.size() * (sizeof(int64_t) + sizeof(CuePoint));
+
+    Core core{};
+    core.duration = c.state.duration;
+    core.windowStart = c.state.windowStart;
+    core.currentPosition = c.state.currentPosition;
+    core.autoHideTimer = c.motion.autoHide();
+    core.loadingSecondsRemaining = c.motion.loadingRemaining();
+    core.width = c.width;
+    core.height = c.height;
+    core.videoCenterY = c.videoCenterY;
+    core.dpiScale = c.res->dpiScale;
+    core.feedbackTimer = c.seekFeedback.timer();
+    core.feedbackSeconds = c.seekFeedback.totalSeconds();
+    core.burstSeconds = c.burst.totalSeconds;
+    core.burstAgeMs = c.burst.active
+        ? static_cast<uint32_t>(std::min<uint64_t>(c.lastNowMs - std::min(c.lastNowMs, c.burst.lastTapTime), UINT32_MAX))
+        : 0;
+    core.uiState = static_cast<uint8_t>(c.uiState);
+    core.flags = (c.returnToPlaying ? kReturnToPlaying : 0) | (c.live ? kLive : 0) |
+                 (c.followLive ? kFollowLive : 0) | (c.state.isLoading ? kLoading : 0) |
+                 (c.isPortrait ? kPortrait : 0) | (c.burst.active ? kBurstActive : 0);
+    core.burstDirection = static_cast<int8_t>(c.burst.direction);
+
+    std::vector<uint8_t> out(header.totalBytes);
+    Writer w(out);
+    w.put(&header, sizeof(header));
+    w.put(&core, sizeof(core));
+    w.put(&c.layout, sizeof(ContainerLayout));
+    for (size_t i = 0; i < chapters.size(); ++i) {
+        const int64_t start = chapters.startUs(i);
+        w.put(&start, sizeof(start));
+    }
+    for (size_t i = 0; i < cues.size(); ++i) {
+        const int64_t t = cues.timeUs(i);
+        w.put(&t, sizeof(t));
+    }
+    for (size_t i = 0; i < chapters.size(); ++i) w.put(&chapters[i].startTime, sizeof(float));
+    for (size_t i = 0; i < cues.size(); ++i) w.put(&cues[i], sizeof(CuePoint));
+    uint32_t titleEnd = 0;
+    for (size_t i = 0; i < chapters.size(); ++i) {
+        titleEnd += static_cast<uint32_t>(chapters[i].title.size());
+        w.put(&titleEnd, sizeof(titleEnd));
+    }
+    for (size_t i = 0; i < chapters.size(); ++i) w.put(chapters[i].title.data(), chapters[i].title.size());
+
+    header.checksum = Checksum(out.data() + sizeof(Header), out.size() - sizeof(Header));
+    std::memcpy(out.data(), &header, sizeof(header));
+    return out;
+}
+
+// =============================================================================
+// Restore
+// =============================================================================
+
+bool VideoContainer::restore(const void* data, size_t size, uint64_t nowMs) {
+    if (!data) return false;
+    Reader r(static_cast<const uint8_t*>(data), size);
+
+    Header header{};
+    if (!r.take(&header, sizeof(header)) || std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.formatVersion != kFormatVersion || header.layoutBytes != sizeof(ContainerLayout) ||
+        header.totalBytes != size ||
+        header.checksum != Checksum(static_cast<const uint8_t*>(data) + sizeof(Header), size - sizeof(Header))) {
+        return false;
+    }
+
+    Core core{};
+    ContainerLayout layout;
+    if (!r.take(&core, sizeof(core)) || !r.take(&layout, sizeof(layout))) return false;
+    if (core.uiState > static_cast<uint8_t>(UIState::Dragging) || core.duration < 0 ||
+        (core.burstDirection != -1 && core.burstDirection != 1)) {
+        return false;
+    }
+
+    // Everything is read and checked before the container is touched
+    std::vector<MediaTimeUs> chapterStarts, cueTimes;
+    std::vector<CuePoint> cuePoints;
+    const uint8_t* chapterSeconds = nullptr;
+    const uint8_t* titleEnds = nullptr;
+    if (!r.takeArray(chapterStarts, header.chapterCount) || !r.takeArray(cueTimes, header.cueCount) ||
+        !(chapterSeconds = r.view(header.chapterCount * sizeof(float))) ||
+        !r.takeArray(cuePoints, header.cueCount) ||
+        !(titleEnds = r.view(header.chapterCount * sizeof(uint32_t))) || r.remaining() != header.titleBytes) {
+        return false;
+    }
+    for (size_t i = 1; i < chapterStarts.size(); ++i) {
+        if (chapterStarts[i] <= chapterStarts[i - 1]) return false;
+    }
+    for (size_t i = 1; i < cueTimes.size(); ++i) {
+        if (cueTimes[i] < cueTimes[i - 1]) return false;
+    }
+
+    const auto* titles = reinterpret_cast<const char*>(r.peek());
+    std::vector<Chapter> chapters;
+    chapters.reserve(header.chapterCount);
+    uint32_t titleStart = 0;
+    for (size_t i = 0; i < header.chapterCount; ++i) {
+        float start;
+        uint32_t titleEnd;
+        std::memcpy(&start, chapterSeconds + i * sizeof(float), sizeof(start));
+        std::memcpy(&titleEnd, titleEnds + i * sizeof(uint32_t), sizeof(titleEnd));
+        if (titleEnd < titleStart || titleEnd > header.titleBytes) return false;
+        chapters.emplace_back(start, std::string(titles + titleStart, titleEnd - titleStart));
+        chapters.back().startUs = chapterStarts[i];
+        titleStart = titleEnd;
+    }
+
+    Impl& c = *impl;
+    c.wake();
+
+    // Layout: adopt the cached one when it was computed for this DPI
+    c.setDpiScale(core.dpiScale);
+    c.width = core.width;
+    c.height = core.height;
+    c.isPortrait = (core.flags & kPortrait) != 0;
+    c.videoCenterY = core.videoCenterY;
+    c.seekBar.setPortraitMode(c.isPortrait);
+    if (c.res->dpiScale == core.dpiScale) {
+        c.layout = layout;
+        c.seekBar.setGeometry(c.layout.seekBar);
+    } else {
+        c.relayout();
+    }
+
+    // Timeline
+    c.state.duration = core.duration;
+    c.state.windowStart = core.windowStart;
+    c.state.currentPosition = core.currentPosition;
+    c.state.isLoading = (core.flags & kLoading) != 0;
+    c.state.chapters.assign(std::move(chapters), std::move(chapterStarts));
+    c.state.cues.assign(std::move(cuePoints), std::move(cueTimes), core.currentPosition);
+    c.live = (core.flags & kLive) != 0;
+    c.followLive = (core.flags & kFollowLive) != 0;
+    c.motion.loadingRemaining() = core.loadingSecondsRemaining;
+    c.seekBar.setState(c.state);
+
+    // Gestures: a burst resumes with its age carried over; a drag can't
+    // (the finger is gone), so it lands where the release would have
+    c.lastNowMs = nowMs;
+    c.tap.reset();
+    c.burst.reset();
+    if (core.flags & kBurstActive) {
+        c.burst.start(static_cast<SeekDirection>(core.burstDirection), core.burstSeconds,
+                      nowMs - std::min<uint64_t>(nowMs, core.burstAgeMs));
+    }
+    c.seekFeedback.restore(core.feedbackSeconds, core.feedbackTimer);
+
+    // UI state, then the timer that entering it reset
+    c.returnToPlaying = (core.flags & kReturnToPlaying) != 0;
+    auto uiState = static_cast<UIState>(core.uiState);
+    if (uiState == UIState::Dragging) uiState = c.returnToPlaying ? UIState::PlayingVisible : UIState::PausedVisible;
+    c.uiState = uiState;
+    c.seekPreviewTooltip.hide();
+    c.applyUIState();
+    c.motion.autoHide() = core.autoHideTimer;
+    return true;
+}
+
+} // namespace skplayer_ui
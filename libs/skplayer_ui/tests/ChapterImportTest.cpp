@@ -0,0 +1,165 @@
+// libs/skplayer_ui/tests/ChapterImportTest.cpp
+//
+// ImportChapters() on small inputs in each format: parsed starts and titles,
+// Auto detection, rollback of `out` on errors, and the reported error lines.
+
+#include "Check.h"
+
+#include "skplayer_ui/ChapterImport.h"
+#include "skplayer_ui/MediaTime.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace skplayer_ui;
+
+constexpr MediaTimeUs kSecond = media_time::kPerSecond;
+
+ChapterImportResult Import(const char* text, std::vector<Chapter>& out,
+                           ChapterFormat format = ChapterFormat::Auto) {
+    return ImportChapters(text, std::strlen(text), out, format);
+}
+
+bool Is(const Chapter& chapter, MediaTimeUs startUs, const char* title) {
+    return chapter.startUs == startUs && chapter.title == title;
+}
+
+bool Failed(const ChapterImportResult& r, const char* error, size_t line) {
+    return !r.ok && r.error && std::strcmp(r.error, error) == 0 && r.errorLine == line;
+}
+
+void TestWebVTT() {
+    std::vector<Chapter> out;
+    const auto r = Import("WEBVTT - Chapters\r\n"
+                          "\r\n"
+                          "NOTE skipped,\r\n"
+                          "as is this\r\n"
+                          "\r\n"
+                          "intro\r\n"
+                          "00:00.000 --> 00:10.500\r\n"
+                          "Intro\r\n"
+                          "\r\n"
+                          "00:10.500 --> 01:00:00.000 align:start\r\n"
+                          "Part\r\n"
+                          "two\r\n"
+                          "\r\n"
+                          "01:00:00,0000015 --> 01:00:01.000\r\n"
+                          "Rounded\r\n",
+                          out);
+    CHECK(r.ok && r.format == ChapterFormat::WebVTT && r.chapters == 3 && out.size() == 3);
+    if (out.size() != 3) return;
+    CHECK(Is(out[0], 0, "Intro"));
+    CHECK(Is(out[1], 10'500'000, "Part two"));
+    CHECK(Is(out[2], 3600 * kSecond + 2, "Rounded"));
+
+    out.clear();
+    CHECK(Failed(Import("WEBVTTX\n", out, ChapterFormat::WebVTT), "missing WEBVTT header", 1));
+    CHECK(Failed(Import("WEBVTT\n\n1\n00:00 --> 00:01\nA\n\n2\nxx:01 --> 00:02\nB\n", out),
+                 "bad cue timestamp", 8));
+    CHECK(out.empty());
+}
+
+void TestJson() {
+    std::vector<Chapter> out;
+    const auto r = Import("{\"title\": \"Talk\",\n"
+                          " \"chapters\": [\n"
+                          "  {\"start\": 0, \"title\": \"A\\u00e9\\ud83d\\ude00\"},\n"
+                          "  {\"startMs\": 1500.4, \"name\": \"B\\n\\\"q\\\"\"},\n"
+                          "  {\"time\": \"1:02.5\", \"title\": \"C\", \"extra\": [1, {\"x\": null}]}\n"
+                          " ],\n"
+                          " \"meta\": {\"chapters\": true}\n"
+                          "}\n",
+                          out);
+    CHECK(r.ok && r.format == ChapterFormat::Json && out.size() == 3);
+    if (out.size() == 3) {
+        CHECK(Is(out[0], 0, "A\xC3\xA9\xF0\x9F\x98\x80"));
+        CHECK(Is(out[1], 1'500'400, "B\n\"q\""));
+        CHECK(Is(out[2], 62'500'000, "C"));
+    }
+
+    out.clear();
+    const auto millis = Import("[{\"start_ms\": 999.9996, \"title\": \"ms\"}]", out);
+    CHECK(millis.ok && out.size() == 1 && Is(out[0], 1'000'000, "ms"));
+
+    out.clear();
+    const auto empty = Import("[ ]", out);
+    CHECK(empty.ok && empty.format == ChapterFormat::Json && out.empty());
+
+    CHECK(Failed(Import("[\n {\"start\": 1},\n {\"title\": \"x\"}\n]", out), "chapter without a start time", 3));
+    CHECK(Failed(Import("[\n {\"start\": 1,}\n]", out), "malformed JSON", 2));
+    CHECK(Failed(Import("{\"other\": []}", out), "no \"chapters\" array", 1));
+    CHECK(Failed(Import("[{\"start\": -1}]", out), "negative start time", 1));
+    CHECK(out.empty());
+}
+
+void TestDescription() {
+    std::vector<Chapter> out;
+    const auto r = Import("\xEF\xBB\xBF"
+                          "Chapters:\n"
+                          "00:00 Intro\n"
+                          "1:02:03 - Part two\n"
+                          "[1:05:00] Outro\n"
+                          "(1:10:00) \xE2\x80\x94 Credits\n"
+                          "1:20:00pm is prose\n"
+                          "Thanks for watching\n",
+                          out);
+    CHECK(r.ok && r.format == ChapterFormat::Description && out.size() == 4);
+    if (out.size() != 4) return;
+    CHECK(Is(out[0], 0, "Intro"));
+    CHECK(Is(out[1], 3723 * kSecond, "Part two"));
+    CHECK(Is(out[2], 3900 * kSecond, "Outro"));
+    CHECK(Is(out[3], 4200 * kSecond, "Credits"));
+}
+
+void TestAutoDetect() {
+    std::vector<Chapter> out;
+    auto r = Import("[00:00] Intro\n[05:00] Outro\n", out);
+    CHECK(r.ok && r.format == ChapterFormat::Description && out.size() == 2);
+
+    out.clear();
+    r = Import("\n  [\n  {\"start\": 1}]", out);
+    CHECK(r.ok && r.format == ChapterFormat::Json && out.size() == 1);
+
+    out.clear();
+    r = Import("WEBVTT\n", out);
+    CHECK(r.ok && r.format == ChapterFormat::WebVTT && out.empty());
+
+    r = Import("", out);
+    CHECK(r.ok && r.format == ChapterFormat::Description && out.empty());
+}
+
+void TestRollback() {
+    std::vector<Chapter> out = {Chapter::AtUs(5 * kSecond, "Existing")};
+
+    // Relative to what is already in `out`
+    CHECK(Failed(Import("00:00 Too early\n", out), "chapter start times must increase", 1));
+    CHECK(out.size() == 1 && Is(out[0], 5 * kSecond, "Existing"));
+
+    // Within the input: the first two were appended, then taken back
+    CHECK(Failed(Import("00:10 A\n00:20 B\n\n00:15 C\n", out), "chapter start times must increase", 4));
+    CHECK(out.size() == 1 && Is(out[0], 5 * kSecond, "Existing"));
+
+    // Equal starts are not increasing either
+    CHECK(Failed(Import("WEBVTT\n\n00:10 --> 00:20\nA\n\n00:10 --> 00:30\nB\n", out),
+                 "chapter start times must increase", 6));
+    CHECK(out.size() == 1);
+
+    // A float-only chapter in `out` is compared by its converted start
+    out = {Chapter(5.0f, "Float")};
+    const auto r = Import("00:06 Next\n", out);
+    CHECK(r.ok && r.chapters == 1 && out.size() == 2 && Is(out[1], 6 * kSecond, "Next"));
+}
+
+} // namespace
+
+int main() {
+    TestWebVTT();
+    TestJson();
+    TestDescription();
+    TestAutoDetect();
+    TestRollback();
+    return CheckFailures() != 0;
+}
@@ -0,0 +1,34 @@
+// libs/skplayer_ui/tests/TimebaseTest.cpp
+//
+// Plays 48 simulated hours through a headless container at 60 Hz and checks
+// its position against the exact sum of the frame steps. A float seconds
+// accumulator is off by minutes over the same run.
+
+#include "Check.h"
+
+#include "skplayer_ui/MediaTime.h"
+#include "skplayer_ui/VideoContainer.h"
+
+#include <cstdint>
+#include <cstdio>
+
+int main() {
+    using namespace skplayer_ui;
+    constexpr int64_t kFrames = int64_t{48} * 3600 * 60;
+    constexpr float kDt = 1.0f / 60.0f;
+
+    VideoContainer::Config cfg;
+    cfg.durationUs = int64_t{49} * 3600 * media_time::kPerSecond;
+    VideoContainer container(cfg);
+
+    for (int64_t i = 1; i <= kFrames; ++i) container.update(kDt, static_cast<uint64_t>(i * 1000 / 60));
+
+    const MediaTimeUs expected = media_time::fromSeconds(static_cast<double>(kDt) * static_cast<double>(kFrames));
+    const MediaTimeUs drift = container.positionUs() - expected;
+    std::printf("48 h at 60 Hz: position %.6f s, expected %.6f s, drift %lld us\n",
+                media_time::toSeconds(container.positionUs()), media_time::toSeconds(expected),
+                static_cast<long long>(drift));
+    CHECK(drift >= -1 && drift <= 1);
+
+    return CheckFailures() != 0;
+}
@@ -0,0 +1,40 @@
+#!/bin/bash
+# scripts/build-skia-host.sh
+# Builds a raster-only Skia for the desktop host (tests and benchmarks)
+
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+PROJECT_ROOT="$(dirname "$SCRIPT_DIR")"
+SKIA_DIR="$PROJECT_ROOT/third_party/skia"
+
+# Add depot_tools to PATH (required for gn and ninja)
+export PATH="$PROJECT_ROOT/third_party/depot_tools:$PATH"
+
+echo "=== Building Skia for the host ==="
+
+cd "$SKIA_DIR"
+
+# Same minimal set as the device builds, without a GPU backend: host tests
+# and benchmarks draw through raster surfaces only
+bin/gn gen out/host --args='
+is_official_build=true
+is_debug=false
+skia_use_gl=false
+skia_use_system_expat=false
+skia_use_system_libpng=false
+skia_use_system_libwebp=false
+skia_use_system_zlib=false
+skia_use_system_libjpeg_turbo=false
+skia_use_system_freetype2=false
+skia_enable_pdf=false
+skia_use_harfbuzz=false
+skia_use_icu=false
+skia_enable_skottie=false
+skia_enable_skshaper=false
+'
+ninja -C out/host skia
+
+echo ""
+echo "=== Skia build complete! ==="
+echo "  host: $SKIA_DIR/out/host/libskia.a"
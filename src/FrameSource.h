@@ -0,0 +1,76 @@
+// src/FrameSource.h
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// One planar YUV picture. Plane pointers reference the source's storage
+// (e.g. a file mapping) and stay valid for the lifetime of the source.
+struct VideoFrame {
+    int64_t index = -1;
+    double timeSeconds = 0.0;
+    const uint8_t* planes[3] = {nullptr, nullptr, nullptr};  // Y, U, V
+    size_t rowBytes[3] = {0, 0, 0};
+
+    [[nodiscard]] bool valid() const { return index >= 0; }
+};
+
+// Where the "video" pictures come from. Implementations decode (or map)
+// frames ahead of the playhead on their own thread; the render thread only
+// asks for the frame at the current playback time.
+class FrameSource {
+public:
+    enum class Chroma { k420, k422, k444 };
+    enum class Matrix { kBT601, kBT709 };
+
+    struct Info {
+        int width = 0;
+        int height = 0;
+        Chroma chroma = Chroma::k420;
+        Matrix matrix = Matrix::kBT601;
+        bool fullRange = false;     // Otherwise video range (Y 16-235, C 16-240)
+        double frameRate = 0.0;
+        int64_t frameCount = 0;
+
+        [[nodiscard]] double durationSeconds() const {
+            return frameRate > 0.0 ? static_cast<double>(frameCount) / frameRate : 0.0;
+        }
+        // Frame shown at `seconds`; the last one past the end. A small epsilon
+        // maps a time computed as index / frameRate back to that index.
+        [[nodiscard]] int64_t indexForTime(double seconds) const {
+            const double frame = std::floor(std::max(seconds, 0.0) * frameRate + 1e-6);
+            return std::min(static_cast<int64_t>(frame), frameCount - 1);
+        }
+        [[nodiscard]] int chromaWidth() const { return chroma == Chroma::k444 ? width : (width + 1) / 2; }
+        [[nodiscard]] int chromaHeight() const { return chroma == Chroma::k420 ? (height + 1) / 2 : height; }
+    };
+
+    struct Stats {
+        uint64_t framesShown = 0;   // Distinct frames handed out
+        uint64_t framesSkipped = 0; // Buffered frames passed over (playhead ran ahead)
+        uint64_t underruns = 0;     // Requested frame not buffered yet; previous one reused
+        uint64_t seeks = 0;
+        size_t buffered = 0;
+    };
+
+    virtual ~FrameSource() = default;
+
+    [[nodiscard]] virtual const Info& info() const = 0;
+
+    // Repositions the reader; the next frameAt() near `seconds` is served
+    // from freshly buffered frames. Cheap enough to call on every scrub.
+    virtual void seek(double seconds) = 0;
+
+    // Frame covering `seconds`, or the most recent one if that isn't buffered
+    // yet. nullptr before the first frame is ready. The pointer stays valid
+    // until the next frameAt() call.
+    virtual const VideoFrame* frameAt(double seconds) = 0;
+
+    // Timestamps of the buffered frames, oldest first (up to `max`), for a
+    // presentation scheduler to choose from.
+    virtual size_t queuedTimes(double* pts, size_t max) const = 0;
+
+    [[nodiscard]] virtual Stats stats() const = 0;
+};
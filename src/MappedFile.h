@@ -0,0 +1,93 @@
+// src/MappedFile.h
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Read-only memory mapping of a whole file (POSIX: Android, iOS, desktop).
+// Pages are faulted in lazily, so opening a large file is cheap.
+class MappedFile {
+public:
+    // nullptr if the file is missing, empty or can't be mapped.
+    static std::unique_ptr<MappedFile> OpenReadOnly(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return nullptr;
+
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            return nullptr;
+        }
+
+        const size_t size = static_cast<size_t>(st.st_size);
+        void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // The mapping keeps the file referenced
+        if (addr == MAP_FAILED) return nullptr;
+
+        return std::unique_ptr<MappedFile>(new MappedFile(addr, size));
+    }
+
+    // Replaces `path` with `size` bytes: write a sibling temp file, fsync, then
+    // rename over the target, so readers never observe a partial file.
+    static bool WriteAtomically(const std::string& path, const void* data, size_t size) {
+        const std::string tmp = path + ".tmp";
+        int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+        if (fd < 0) return false;
+
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        size_t written = 0;
+        while (written < size) {
+            ssize_t n = ::write(fd, bytes + written, size - written);
+            if (n <= 0) break;
+            written += static_cast<size_t>(n);
+        }
+        bool ok = (written == size) && ::fsync(fd) == 0;
+        ok = (::close(fd) == 0) && ok;
+
+        if (!ok || ::rename(tmp.c_str(), path.c_str()) != 0) {
+            ::unlink(tmp.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    static void Remove(const std::string& path) { ::unlink(path.c_str()); }
+
+    ~MappedFile() { ::munmap(addr_, size_); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const uint8_t* data() const { return static_cast<const uint8_t*>(addr_); }
+    size_t size() const { return size_; }
+
+    // Faults in [offset, offset + length) on the calling thread, so a later
+    // reader of that range doesn't block on I/O.
+    void prefetch(size_t offset, size_t length) const {
+        if (offset >= size_) return;
+        length = std::min(length, size_ - offset);
+        const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        const size_t begin = offset & ~(page - 1);
+        ::madvise(static_cast<uint8_t*>(addr_) + begin, offset + length - begin, MADV_WILLNEED);
+
+        const volatile uint8_t* bytes = data();
+        uint8_t sink = 0;
+        for (size_t at = begin; at < offset + length; at += page) sink ^= bytes[std::max(at, offset)];
+        (void)sink;
+    }
+
+private:
+    MappedFile(void* addr, size_t size) : addr_(addr), size_(size) {}
+
+    void* addr_;
+    size_t size_;
+};
@@ -0,0 +1,132 @@
+// src/PresentationScheduler.cpp
+#include "PresentationScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace {
+
+// Weight of each new in-range vsync delta in the period estimate
+constexpr double kPeriodSmoothing = 0.05;
+
+// Deltas beyond this many swap intervals are idle gaps, not missed vsyncs
+constexpr double kMaxMissedPeriods = 4.0;
+
+// Timestamps within this of the vsync count as due (float noise in pts math)
+constexpr double kDueEpsilonSeconds = 1e-4;
+
+} // namespace
+
+PresentationScheduler::PresentationScheduler(const Config& config)
+    : config_(config)
+    , period_(1.0 / std::max(config.nominalRefreshHz, 1.0)) {}
+
+// =============================================================================
+// Display clock
+// =============================================================================
+
+void PresentationScheduler::onVsync(double presentSeconds, int swapInterval) {
+    const int interval = std::max(swapInterval, 1);
+    const double delta = presentSeconds - lastVsync_;
+    const bool continuous = lastVsync_ >= 0.0 && delta > 0.0 && delta < period_ * interval * kMaxMissedPeriods;
+    lastVsync_ = presentSeconds;
+    swapInterval_ = interval;
+    if (!continuous) return;
+
+    ++vsyncs_;
+
+    // Panel vsyncs since the last present; `interval` of them are by design
+    const double periods = delta / period_;
+    if (periods >= interval - 0.5 && periods < interval + 0.5) {
+        period_ += (delta / interval - period_) * kPeriodSmoothing;
+    }
+    const long elapsed = std::lround(periods);
+    if (elapsed > interval) missedVsyncs_ += static_cast<uint64_t>(elapsed - interval);
+    // The frame on screen stayed up through all of them
+    if (lastIndex_ >= 0 && elapsed > 1) heldVsyncs_ += static_cast<uint32_t>(elapsed - 1);
+}
+
+double PresentationScheduler::predictNextVsync(double nowSeconds) const {
+    const double step = period_ * swapInterval_;
+    if (lastVsync_ < 0.0 || nowSeconds < lastVsync_) return nowSeconds + step;
+    const double elapsed = std::floor((nowSeconds - lastVsync_) / step) + 1.0;
+    return lastVsync_ + elapsed * step;
+}
+
+// =============================================================================
+// Frame choice
+// =============================================================================
+
+int PresentationScheduler::choose(const double* queuePts, size_t count, double mediaTimeAtVsync) const {
+    if (!queuePts || count == 0) return -1;
+    const double due = mediaTimeAtVsync + kDueEpsilonSeconds;
+
+    if (config_.latePolicy == LatePolicy::kPresentEveryFrame) {
+        return queuePts[0] <= due ? 0 : -1;
+    }
+
+    // Latest frame that is already due; everything before it is late
+    const double* end = queuePts + count;
+    const double* firstFuture = std::upper_bound(queuePts, end, due);
+    return firstFuture == queuePts ? -1 : static_cast<int>(firstFuture - queuePts) - 1;
+}
+
+// =============================================================================
+// Accounting
+// =============================================================================
+
+void PresentationScheduler::closeCadence() {
+    if (lastIndex_ < 0 || heldVsyncs_ == 0) return;
+    ++cadence_[std::min<uint32_t>(heldVsyncs_, 4) - 1];
+}
+
+void PresentationScheduler::onPresented(int64_t frameIndex, double framePts, double mediaTimeAtVsync,
+                                        double frameDuration) {
+    if (frameIndex == lastIndex_) {
+        // Repeat: expected while the frame's interval lasts, a duplicate after
+        ++heldVsyncs_;
+        if (mediaTimeAtVsync >= framePts + frameDuration + kDueEpsilonSeconds) ++duplicated_;
+        return;
+    }
+
+    if (lastIndex_ >= 0 && frameIndex > lastIndex_ + 1) {
+        dropped_ += static_cast<uint64_t>(frameIndex - lastIndex_ - 1);
+    }
+    closeCadence();
+    lastIndex_ = frameIndex;
+    heldVsyncs_ = 1;
+    ++presented_;
+
+    const double error = framePts - mediaTimeAtVsync;
+    ++errorCount_;
+    errorSum_ += error;
+    errorSumSq_ += error * error;
+    errorAbsSum_ += std::fabs(error);
+    errorAbsMax_ = std::max(errorAbsMax_, std::fabs(error));
+}
+
+void PresentationScheduler::resetTimeline() {
+    closeCadence();
+    lastIndex_ = -1;
+    heldVsyncs_ = 0;
+}
+
+PresentationScheduler::Stats PresentationScheduler::stats() const {
+    Stats s;
+    s.vsyncs = vsyncs_;
+    s.missedVsyncs = missedVsyncs_;
+    s.presented = presented_;
+    s.dropped = dropped_;
+    s.duplicated = duplicated_;
+    s.refreshHz = 1.0 / period_;
+    std::copy(std::begin(cadence_), std::end(cadence_), s.cadence);
+    if (errorCount_ > 0) {
+        const double n = static_cast<double>(errorCount_);
+        const double mean = errorSum_ / n;
+        s.judderMeanMs = errorAbsSum_ / n * 1e3;
+        s.judderStdDevMs = std::sqrt(std::max(errorSumSq_ / n - mean * mean, 0.0)) * 1e3;
+        s.judderMaxMs = errorAbsMax_ * 1e3;
+    }
+    return s;
+}
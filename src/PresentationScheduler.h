@@ -0,0 +1,99 @@
+// src/PresentationScheduler.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Chooses which timestamped frame goes on screen at the next vsync and keeps
+// score of how well playback tracks the display clock.
+//
+// Display clock: onVsync() is fed the time each frame was presented and the
+// swap interval it was presented with. The panel's refresh period is
+// estimated from those deltas (missed vsyncs count as multiples beyond the
+// interval, idle gaps are ignored), which predicts the next present.
+//
+// Choice: given the presentation timestamps of the buffered frames and the
+// media time that will be current at that vsync, pick the frame whose
+// interval contains it. Frames that became late while waiting are dropped
+// (kDrop) or still shown one per vsync (kPresentEveryFrame, for inspecting
+// the source's pacing).
+//
+// Accounting, per presented frame:
+//   dropped     frames between two presented ones that never reached the screen
+//   duplicated  the previous frame shown again although a newer one was due
+//   judder      presentation error: frame pts minus media time at its vsync
+//   cadence     how many vsyncs each frame stayed up (1, 2, 3, 4+)
+class PresentationScheduler {
+public:
+    enum class LatePolicy { kDrop, kPresentEveryFrame };
+
+    struct Config {
+        LatePolicy latePolicy = LatePolicy::kDrop;
+        double nominalRefreshHz = 60.0;  // The panel's; refined as vsyncs are measured
+    };
+
+    struct Stats {
+        uint64_t vsyncs = 0;
+        uint64_t missedVsyncs = 0;      // Present came one or more periods late
+        uint64_t presented = 0;         // Distinct frames
+        uint64_t dropped = 0;
+        uint64_t duplicated = 0;
+        double refreshHz = 0.0;
+        double judderMeanMs = 0.0;      // Mean |error|
+        double judderStdDevMs = 0.0;    // Of the signed error
+        double judderMaxMs = 0.0;       // Max |error|
+        uint64_t cadence[4] = {0, 0, 0, 0};
+    };
+
+    PresentationScheduler() : PresentationScheduler(Config{}) {}
+    explicit PresentationScheduler(const Config& config);
+
+    // ---- Display clock ----
+    // Call after every present, before onPresented(). `swapInterval` is the
+    // number of panel vsyncs per present the swap was set to.
+    void onVsync(double presentSeconds, int swapInterval = 1);
+    [[nodiscard]] double refreshPeriod() const { return period_; }
+    [[nodiscard]] double predictNextVsync(double nowSeconds) const;
+
+    // ---- Frame choice ----
+    // `queuePts` holds the buffered frames' timestamps in ascending order.
+    // Returns the index of the frame to present, or -1 to keep the current one.
+    [[nodiscard]] int choose(const double* queuePts, size_t count, double mediaTimeAtVsync) const;
+
+    // ---- Accounting ----
+    // After each present that showed a frame. `frameDuration` is 1 / fps.
+    void onPresented(int64_t frameIndex, double framePts, double mediaTimeAtVsync, double frameDuration);
+
+    // Seek, pause or resume: the next frame starts a new timeline, so the
+    // jump isn't counted as drops or judder.
+    void resetTimeline();
+
+    [[nodiscard]] Stats stats() const;
+
+private:
+    void closeCadence();
+
+    Config config_;
+
+    // Display clock
+    double period_;
+    double lastVsync_ = -1.0;
+    int swapInterval_ = 1;
+    uint64_t vsyncs_ = 0;
+    uint64_t missedVsyncs_ = 0;
+
+    // Timeline
+    int64_t lastIndex_ = -1;
+    uint32_t heldVsyncs_ = 0;   // Vsyncs the current frame has been up
+    uint64_t presented_ = 0;
+    uint64_t dropped_ = 0;
+    uint64_t duplicated_ = 0;
+    uint64_t cadence_[4] = {0, 0, 0, 0};
+
+    // Judder accumulators (seconds)
+    uint64_t errorCount_ = 0;
+    double errorSum_ = 0.0;
+    double errorSumSq_ = 0.0;
+    double errorAbsSum_ = 0.0;
+    double errorAbsMax_ = 0.0;
+};
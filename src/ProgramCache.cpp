@@ -0,0 +1,265 @@
+// src/ProgramCache.cpp
+#include "ProgramCache.h"
+
+#include "include/core/SkTypes.h"  // SK_MILESTONE
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace {
+
+// =============================================================================
+// File format
+// =============================================================================
+//
+//   FileHeader
+//   { EntryHeader, key bytes, value bytes, pad to 8 } * entryCount
+//
+// Native endianness: the file never leaves the device.
+
+constexpr char kMagic[4] = {'S', 'K', 'P', 'C'};
+constexpr uint32_t kFormatVersion = 1;
+
+struct FileHeader {
+    char magic[4];
+    uint32_t formatVersion;
+    uint32_t skiaMilestone;
+    uint32_t entryCount;
+    uint64_t generation;
+};
+
+struct EntryHeader {
+    uint32_t keySize;
+    uint32_t valueSize;
+    uint64_t lastUsed;
+    uint32_t checksum;  // FNV-1a over key + value
+    uint32_t reserved;
+};
+
+constexpr size_t Align8(size_t n) { return (n + 7) & ~size_t{7}; }
+
+uint64_t Fnv1a64(const void* data, size_t size, uint64_t h = 1469598103934665603ull) {
+    const auto* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) h = (h ^ p[i]) * 1099511628211ull;
+    return h;
+}
+
+uint32_t Fnv1a32(const void* data, size_t size, uint32_t h = 2166136261u) {
+    const auto* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+uint32_t EntryChecksum(const uint8_t* key, size_t keySize, const uint8_t* value, size_t valueSize) {
+    return Fnv1a32(value, valueSize, Fnv1a32(key, keySize));
+}
+
+template <typename T>
+void Append(std::vector<uint8_t>& out, const T& pod) {
+    const auto* p = reinterpret_cast<const uint8_t*>(&pod);
+    out.insert(out.end(), p, p + sizeof(T));
+}
+
+} // namespace
+
+// =============================================================================
+// ProgramCache
+// =============================================================================
+
+bool ProgramCache::open(const std::string& path) {
+    path_ = path;
+    entries_.clear();
+    stats_ = {};
+    file_ = MappedFile::OpenReadOnly(path);
+    if (!file_) return true;  // First run
+
+    const uint8_t* base = file_->data();
+    const size_t size = file_->size();
+
+    FileHeader header{};
+    bool valid = size >= sizeof(FileHeader);
+    if (valid) {
+        std::memcpy(&header, base, sizeof(header));
+        valid = std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+                header.formatVersion == kFormatVersion;
+    }
+    if (!valid || header.skiaMilestone != SK_MILESTONE) {
+        // Unknown layout or programs from another Skia: start over
+        stats_.corrupt = !valid;
+        file_.reset();
+        MappedFile::Remove(path);
+        return valid;
+    }
+    generation_ = header.generation + 1;
+
+    size_t offset = sizeof(FileHeader);
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+        EntryHeader eh{};
+        if (size - offset < sizeof(EntryHeader)) { stats_.corrupt = true; break; }
+        std::memcpy(&eh, base + offset, sizeof(eh));
+
+        const size_t payload = size_t{eh.keySize} + eh.valueSize;
+        const size_t body = offset + sizeof(EntryHeader);
+        if (size - body < payload) { stats_.corrupt = true; break; }
+
+        const uint8_t* key = base + body;
+        const uint8_t* value = key + eh.keySize;
+        if (EntryChecksum(key, eh.keySize, value, eh.valueSize) != eh.checksum) {
+            stats_.corrupt = true;
+            break;
+        }
+
+        Entry e;
+        e.key.assign(key, key + eh.keySize);
+        e.mapped = value;
+        e.size = eh.valueSize;
+        e.lastUsed = eh.lastUsed;
+        stats_.bytes += e.size;
+        entries_.emplace(Fnv1a64(key, eh.keySize), std::move(e));
+
+        offset = Align8(body + payload);
+        if (offset > size) offset = size;
+    }
+
+    stats_.entries = entries_.size();
+    // Rewrite without the damaged tail on the next flush
+    dirty_ = stats_.corrupt;
+    return !stats_.corrupt;
+}
+
+ProgramCache::Entry* ProgramCache::find(const SkData& key, uint64_t hash) {
+    auto range = entries_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        const Entry& e = it->second;
+        if (e.key.size() == key.size() && std::memcmp(e.key.data(), key.data(), key.size()) == 0) {
+            return &it->second;
+        }
+    }
+    return nullptr;
+}
+
+sk_sp<SkData> ProgramCache::load(const SkData& key) {
+    Entry* e = find(key, Fnv1a64(key.data(), key.size()));
+    if (!e) {
+        ++stats_.misses;
+        return nullptr;
+    }
+    ++stats_.hits;
+    if (e->lastUsed != generation_) {
+        e->lastUsed = generation_;
+        dirty_ = true;
+    }
+    if (e->stored) return e->stored;
+    // Copy out of the mapping: Skia may hold the data past our next flush
+    return SkData::MakeWithCopy(e->mapped, e->size);
+}
+
+void ProgramCache::store(const SkData& key, const SkData& data, const SkString& /*description*/) {
+    const uint64_t hash = Fnv1a64(key.data(), key.size());
+    Entry* e = find(key, hash);
+    if (!e) {
+        Entry fresh;
+        fresh.key.assign(key.bytes(), key.bytes() + key.size());
+        e = &entries_.emplace(hash, std::move(fresh))->second;
+    } else {
+        stats_.bytes -= e->size;
+    }
+
+    e->stored = SkData::MakeWithCopy(data.data(), data.size());
+    e->mapped = nullptr;
+    e->size = data.size();
+    e->lastUsed = generation_;
+    stats_.bytes += e->size;
+    stats_.entries = entries_.size();
+    ++stats_.stores;
+    dirty_ = true;
+}
+
+void ProgramCache::evict() {
+    // Programs unused for several sessions (old shaders, changed drivers)
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (generation_ - it->second.lastUsed > kMaxIdleSessions) {
+            stats_.bytes -= it->second.size;
+            ++stats_.evicted;
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Then least recently used until under the byte cap
+    while (stats_.bytes > maxBytes_ && !entries_.empty()) {
+        auto oldest = std::min_element(entries_.begin(), entries_.end(),
+            [](const auto& a, const auto& b) { return a.second.lastUsed < b.second.lastUsed; });
+        stats_.bytes -= oldest->second.size;
+        ++stats_.evicted;
+        entries_.erase(oldest);
+    }
+    stats_.entries = entries_.size();
+}
+
+bool ProgramCache::flush() {
+    if (!dirty_ || path_.empty()) return true;
+    evict();
+
+    std::vector<uint8_t> out;
+    out.reserve(sizeof(FileHeader) + stats_.bytes + entries_.size() * 64);
+
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.formatVersion = kFormatVersion;
+    header.skiaMilestone = SK_MILESTONE;
+    header.entryCount = static_cast<uint32_t>(entries_.size());
+    header.generation = generation_;
+    Append(out, header);
+
+    for (const auto& [hash, e] : entries_) {
+        const uint8_t* value = e.value();
+        EntryHeader eh{};
+        eh.keySize = static_cast<uint32_t>(e.key.size());
+        eh.valueSize = static_cast<uint32_t>(e.size);
+        eh.lastUsed = e.lastUsed;
+        eh.checksum = EntryChecksum(e.key.data(), e.key.size(), value, e.size);
+        Append(out, eh);
+        out.insert(out.end(), e.key.begin(), e.key.end());
+        out.insert(out.end(), value, value + e.size);
+        out.resize(Align8(out.size()), 0);
+    }
+
+    // The old mapping stays valid after the rename, so mapped entries keep
+    // pointing at live memory until the next open().
+    if (!MappedFile::WriteAtomically(path_, out.data(), out.size())) return false;
+    dirty_ = false;
+    return true;
+}
+
+// =============================================================================
+// Runtime effect cache
+// =============================================================================
+
+sk_sp<SkRuntimeEffect> MakeCachedShaderEffect(const char* sksl, SkString* error) {
+    struct Cached {
+        std::string source;
+        sk_sp<SkRuntimeEffect> effect;
+    };
+    static std::mutex mutex;
+    static std::unordered_multimap<uint64_t, Cached> cache;
+
+    const size_t length = std::strlen(sksl);
+    const uint64_t hash = Fnv1a64(sksl, length);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto range = cache.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.source == sksl) return it->second.effect;
+    }
+
+    auto result = SkRuntimeEffect::MakeForShader(SkString(sksl));
+    if (!result.effect) {
+        if (error) *error = result.errorText;
+        return nullptr;
+    }
+    cache.emplace(hash, Cached{std::string(sksl, length), result.effect});
+    return result.effect;
+}
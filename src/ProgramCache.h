@@ -0,0 +1,84 @@
+// src/ProgramCache.h
+#pragma once
+
+#include "MappedFile.h"
+
+#include "include/core/SkData.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkString.h"
+#include "include/effects/SkRuntimeEffect.h"
+#include "include/gpu/ganesh/GrContextOptions.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Persistent key-value store for compiled GPU programs, plugged into Skia via
+// GrContextOptions::fPersistentCache.
+//
+// The file is memory-mapped on open and indexed in place. Stores are kept in
+// memory and written back by flush() (atomic replace). Entries carry an
+// FNV checksum; a bad header, a different Skia milestone or a corrupt entry
+// discards the affected data instead of handing it to the driver. Entries not
+// used for kMaxIdleSessions flushes, and the oldest ones beyond maxBytes, are
+// evicted on flush.
+class ProgramCache final : public GrContextOptions::PersistentCache {
+public:
+    static constexpr size_t kDefaultMaxBytes = 8u * 1024 * 1024;
+    static constexpr uint32_t kMaxIdleSessions = 8;
+
+    struct Stats {
+        size_t entries = 0;
+        size_t bytes = 0;
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        uint32_t stores = 0;
+        uint32_t evicted = 0;
+        bool corrupt = false;    // Data was discarded while opening
+    };
+
+    explicit ProgramCache(size_t maxBytes = kDefaultMaxBytes) : maxBytes_(maxBytes) {}
+
+    // Maps and indexes `path` (missing file = empty cache). Returns false if
+    // existing data had to be discarded; the cache is usable either way.
+    bool open(const std::string& path);
+
+    // Writes the merged contents back if anything changed. Safe to call often.
+    bool flush();
+
+    [[nodiscard]] const Stats& stats() const { return stats_; }
+
+    // GrContextOptions::PersistentCache
+    sk_sp<SkData> load(const SkData& key) override;
+    void store(const SkData& key, const SkData& data, const SkString& description) override;
+
+private:
+    struct Entry {
+        std::vector<uint8_t> key;
+        const uint8_t* mapped = nullptr;  // Value inside file_, or...
+        sk_sp<SkData> stored;             // ...a value stored this session
+        size_t size = 0;
+        uint64_t lastUsed = 0;            // Session generation
+
+        const uint8_t* value() const { return stored ? stored->bytes() : mapped; }
+    };
+
+    Entry* find(const SkData& key, uint64_t hash);
+    void evict();
+
+    std::string path_;
+    std::unique_ptr<MappedFile> file_;
+    std::unordered_multimap<uint64_t, Entry> entries_;  // By key hash
+    uint64_t generation_ = 1;
+    size_t maxBytes_;
+    bool dirty_ = false;
+    Stats stats_;
+};
+
+// In-process cache of compiled SkRuntimeEffects keyed by source hash. SkSL
+// compilation is CPU-side and independent of the GPU context, so re-running
+// initialization (e.g. after context loss) reuses the compiled effect.
+sk_sp<SkRuntimeEffect> MakeCachedShaderEffect(const char* sksl, SkString* error = nullptr);
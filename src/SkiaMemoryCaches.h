@@ -0,0 +1,60 @@
+// src/SkiaMemoryCaches.h
+#pragma once
+
+#include "skplayer_ui/MemoryGovernor.h"
+
+#include "include/core/SkGraphics.h"
+#include "include/gpu/ganesh/GrDirectContext.h"
+
+#include <cstddef>
+
+// MemoryGovernor adapters for Skia's own caches. The library can't see these
+// (it only gets a canvas), so the app registers them next to its
+// ResourceContext.
+
+// GPU resource cache of one GrDirectContext (textures, buffers, programs).
+class GpuResourceCache final : public skplayer_ui::MemoryCache {
+public:
+    // Re-point after the context is recreated (e.g. GL context loss).
+    void setContext(GrDirectContext* context) { context_ = context; }
+
+    const char* cacheName() const override { return "skia.gpu"; }
+
+    size_t bytesUsed() const override {
+        if (!usable()) return 0;
+        size_t bytes = 0;
+        context_->getResourceCacheUsage(nullptr, &bytes);
+        return bytes;
+    }
+
+    void setByteBudget(size_t bytes) override {
+        if (usable()) context_->setResourceCacheLimit(bytes);
+    }
+
+    void purgeUnlocked() override {
+        if (usable()) context_->purgeUnlockedResources(GrPurgeResourceOptions::kAllResources);
+    }
+
+private:
+    bool usable() const { return context_ && !context_->abandoned(); }
+
+    GrDirectContext* context_ = nullptr;
+};
+
+// Process-wide glyph cache.
+class SkiaFontCache final : public skplayer_ui::MemoryCache {
+public:
+    const char* cacheName() const override { return "skia.fonts"; }
+    size_t bytesUsed() const override { return SkGraphics::GetFontCacheUsed(); }
+    void setByteBudget(size_t bytes) override { SkGraphics::SetFontCacheLimit(bytes); }
+    void purgeUnlocked() override { SkGraphics::PurgeFontCache(); }
+};
+
+// Process-wide raster resource cache (decoded images, blur masks, ...).
+class SkiaRasterCache final : public skplayer_ui::MemoryCache {
+public:
+    const char* cacheName() const override { return "skia.raster"; }
+    size_t bytesUsed() const override { return SkGraphics::GetResourceCacheTotalBytesUsed(); }
+    void setByteBudget(size_t bytes) override { SkGraphics::SetResourceCacheTotalByteLimit(bytes); }
+    void purgeUnlocked() override { SkGraphics::PurgeResourceCache(); }
+};
@@ -1,32 +1,114 @@
 // src/SpaceExplorationShader.h
 #pragma once
 
+#include "ProgramCache.h"
+#include "StarfieldBake.h"
+
 #include "include/core/SkCanvas.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkM44.h"
 #include "include/core/SkPaint.h"
+#include "include/core/SkMatrix.h"
 #include "include/core/SkRect.h"
+#include "include/core/SkSamplingOptions.h"
+#include "include/core/SkTileMode.h"
 #include "include/effects/SkRuntimeEffect.h"
 
+#include <cmath>
+#include <cstring>
+#include <utility>
+
 // Star Nest by Pablo Roman Andrioli (MIT License)
-// Animated space exploration shader for video simulation
+// Animated space exploration shader for video simulation.
+//
+// Everything that depends only on time (the two camera rotations and the
+// camera position) is computed once per frame here and passed as uniforms;
+// the SkSL only does per-pixel work. Iteration and volume-step counts are
+// uniforms too, bounded by the Ultra tier's constants, so switching quality
+// is a uniform change rather than a recompile.
+//
+// Mode::kBaked replaces the volume with a StarfieldBake texture scrolled and
+// rotated by the same camera: one filtered texture tap per pixel instead of
+// the nested loop, for devices that can't afford any live tier.
 class SpaceExplorationShader {
 public:
+    enum class Mode { kLive, kBaked };
+
+    enum class Quality { kLow, kMedium, kHigh, kUltra };
+    static constexpr int kQualityCount = 4;
+
+    struct Tier {
+        const char* name;
+        int iterations;  // Fractal folds per volume step
+        int volsteps;    // Samples along each ray
+    };
+
+    static constexpr Tier TierFor(Quality q) {
+        switch (q) {
+            case Quality::kLow: return {"low", 10, 8};
+            case Quality::kMedium: return {"medium", 13, 12};
+            case Quality::kHigh: return {"high", 15, 16};
+            case Quality::kUltra: break;
+        }
+        return {"ultra", 17, 20};  // The original shader
+    }
+
+    // Accepts a tier name ("low", "medium", "high", "ultra").
+    static bool ParseQuality(const char* name, Quality* out) {
+        if (!name || !out) return false;
+        for (int i = 0; i < kQualityCount; ++i) {
+            const auto q = static_cast<Quality>(i);
+            if (std::strcmp(name, TierFor(q).name) == 0) {
+                *out = q;
+                return true;
+            }
+        }
+        return false;
+    }
+
     bool initialize() {
-        auto result = SkRuntimeEffect::MakeForShader(SkString(kShaderCode));
-        if (!result.effect) return false;
-        effect_ = result.effect;
-        return true;
+        setEffect(Compile());
+        return effect_ != nullptr;
     }
 
+    // SkSL compilation only, no GPU work: safe to run on a worker thread.
+    // Compiled once per process; later calls reuse the effect.
+    static sk_sp<SkRuntimeEffect> Compile() { return MakeCachedShaderEffect(kShaderCode); }
+
+    void setEffect(sk_sp<SkRuntimeEffect> effect) { effect_ = std::move(effect); }
+
     void setTime(float t) { time_ = t; }
     [[nodiscard]] float getTime() const { return time_; }
-    [[nodiscard]] bool isReady() const { return effect_ != nullptr; }
+    // Mode::kBaked draws the live shader until the field has been baked.
+    [[nodiscard]] bool isReady() const { return effect_ != nullptr || (mode_ == Mode::kBaked && field_); }
+
+    void setQuality(Quality q) { quality_ = q; }
+    [[nodiscard]] Quality quality() const { return quality_; }
+
+    void setMode(Mode m) { mode_ = m; }
+    [[nodiscard]] Mode mode() const { return mode_; }
 
-    void render(SkCanvas* canvas, const SkRect& bounds) {
+    // The StarfieldBake image for Mode::kBaked.
+    void setBakedField(sk_sp<SkImage> field) { field_ = std::move(field); }
+    [[nodiscard]] bool hasBakedField() const { return field_ != nullptr; }
+
+    void render(SkCanvas* canvas, const SkRect& bounds) const {
+        if (mode_ == Mode::kBaked && field_) {
+            renderBaked(canvas, bounds);
+            return;
+        }
         if (!canvas || !effect_) return;
 
+        const Tier tier = TierFor(quality_);
+        const Camera camera = CameraAt(time_);
+
         SkRuntimeShaderBuilder builder(effect_);
         builder.uniform("iResolution") = SkV2{bounds.width(), bounds.height()};
-        builder.uniform("iTime") = time_;
+        builder.uniform("rot1") = camera.rot1;
+        builder.uniform("rot2") = camera.rot2;
+        builder.uniform("from") = camera.from;
+        builder.uniform("iterations") = tier.iterations;
+        builder.uniform("volsteps") = tier.volsteps;
 
         auto shader = builder.makeShader();
         if (!shader) return;
@@ -41,20 +123,95 @@ public:
     }
 
 private:
+    // Maps the texture onto the view the live shader would show: the view's
+    // width spans kBakedSpan world units around the camera's xy, rotated
+    // like rot2. Positions wrap by the bake period to keep float precision.
+    void renderBaked(SkCanvas* canvas, const SkRect& bounds) const {
+        if (!canvas || bounds.width() <= 0.0f) return;
+        constexpr float kBakedSpan = 0.6f;
+
+        const Camera camera = CameraAt(time_);
+        const float texels = static_cast<float>(field_->width()) / StarfieldBake::kPeriod;
+        const float w = bounds.width();
+
+        SkMatrix localFromTexture = SkMatrix::Scale(1.0f / texels, 1.0f / texels);
+        localFromTexture.postTranslate(-std::fmod(camera.from.x, StarfieldBake::kPeriod),
+                                       -std::fmod(camera.from.y, StarfieldBake::kPeriod));
+        localFromTexture.postScale(w / kBakedSpan, w / kBakedSpan);
+        localFromTexture.postRotate(camera.angle2 * 57.29578f);
+        localFromTexture.postTranslate(w * 0.5f, bounds.height() * 0.5f);
+
+        SkPaint paint;
+        paint.setShader(field_->makeShader(SkTileMode::kRepeat, SkTileMode::kRepeat,
+                                           SkSamplingOptions(SkFilterMode::kLinear), &localFromTexture));
+
+        canvas->save();
+        canvas->translate(bounds.left(), bounds.top());
+        canvas->drawRect(SkRect::MakeWH(bounds.width(), bounds.height()), paint);
+        canvas->restore();
+    }
+
+    // float2x2, column-major as SkSL expects
+    struct Mat2 {
+        float m[4];
+    };
+
+    struct Camera {
+        Mat2 rot1;
+        Mat2 rot2;
+        float angle2;  // rot2's angle, radians
+        SkV3 from;
+    };
+
+    static Mat2 Rotation(float a) {
+        const float c = std::cos(a), s = std::sin(a);
+        return {{c, s, -s, c}};
+    }
+
+    // Row vector times matrix, i.e. SkSL's `v *= m` on a vec2
+    static void MulRow(float* x, float* y, const Mat2& r) {
+        const float nx = *x * r.m[0] + *y * r.m[1];
+        const float ny = *x * r.m[2] + *y * r.m[3];
+        *x = nx;
+        *y = ny;
+    }
+
+    static Camera CameraAt(float iTime) {
+        constexpr float kSpeed = 0.010f;
+        const float time = iTime * kSpeed + 0.25f;
+
+        Camera camera;
+        camera.rot1 = Rotation(0.5f + time * 0.1f);
+        camera.angle2 = 0.8f + time * 0.05f;
+        camera.rot2 = Rotation(camera.angle2);
+        SkV3 from{1.0f + time * 2.0f, 0.5f + time, 0.5f - 2.0f};
+        MulRow(&from.x, &from.z, camera.rot1);
+        MulRow(&from.x, &from.y, camera.rot2);
+        camera.from = from;
+        return camera;
+    }
+
     sk_sp<SkRuntimeEffect> effect_;
     float time_ = 0.0f;
+    Quality quality_ = Quality::kUltra;
+    Mode mode_ = Mode::kLive;
+    sk_sp<SkImage> field_;
 
     static constexpr const char* kShaderCode = R"(
 uniform float2 iResolution;
-uniform float iTime;
+uniform float2x2 rot1;
+uniform float2x2 rot2;
+uniform float3 from;
+uniform int iterations;
+uniform int volsteps;
 
-const int iterations = 17;
+// Loop bounds must be constant: the Ultra tier, cut short by the uniforms
+const int kMaxIterations = 17;
+const int kMaxVolsteps = 20;
 const float formuparam = 0.53;
-const int volsteps = 20;
 const float stepsize = 0.1;
 const float zoom = 0.800;
 const float tile = 0.850;
-const float speed = 0.010;
 const float brightness = 0.0015;
 const float darkmatter = 0.300;
 const float distfading = 0.730;
@@ -64,28 +221,20 @@ half4 main(vec2 fragCoord) {
     vec2 uv = fragCoord.xy / iResolution.xy - 0.5;
     uv.y *= iResolution.y / iResolution.x;
     vec3 dir = vec3(uv * zoom, 1.0);
-    float time = iTime * speed + 0.25;
-
-    float a1 = 0.5 + time * 0.1;
-    float a2 = 0.8 + time * 0.05;
-    mat2 rot1 = mat2(cos(a1), sin(a1), -sin(a1), cos(a1));
-    mat2 rot2 = mat2(cos(a2), sin(a2), -sin(a2), cos(a2));
     dir.xz *= rot1;
     dir.xy *= rot2;
-    vec3 from = vec3(1.0, 0.5, 0.5);
-    from += vec3(time * 2.0, time, -2.0);
-    from.xz *= rot1;
-    from.xy *= rot2;
 
     float s = 0.1;
     float fade = 1.0;
     vec3 v = vec3(0.0);
-    for (int r = 0; r < volsteps; r++) {
+    for (int r = 0; r < kMaxVolsteps; r++) {
+        if (r >= volsteps) break;
         vec3 p = from + s * dir * 0.5;
         p = abs(vec3(tile) - mod(p, vec3(tile * 2.0)));
         float pa = 0.0;
         float a = 0.0;
-        for (int i = 0; i < iterations; i++) {
+        for (int i = 0; i < kMaxIterations; i++) {
+            if (i >= iterations) break;
             p = abs(p) / dot(p, p) - formuparam;
             a += abs(length(p) - pa);
             pa = length(p);
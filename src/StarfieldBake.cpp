@@ -0,0 +1,181 @@
+// src/StarfieldBake.cpp
+#include "StarfieldBake.h"
+
+#include "MappedFile.h"
+#include "ProgramCache.h"
+#include "TiledRenderer.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkSurface.h"
+#include "include/effects/SkRuntimeEffect.h"
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+// Star Nest by Pablo Roman Andrioli (MIT License), ultra tier, with parallel
+// rays so that one 2 * tile period in x and y tiles seamlessly.
+constexpr const char* kBakeCode = R"(
+uniform float2 iResolution;
+
+const int iterations = 17;
+const int volsteps = 20;
+const float formuparam = 0.53;
+const float stepsize = 0.1;
+const float tile = 0.850;
+const float brightness = 0.0015;
+const float darkmatter = 0.300;
+const float distfading = 0.730;
+const float saturation = 0.850;
+
+half4 main(vec2 fragCoord) {
+    vec3 from = vec3(fragCoord / iResolution * (tile * 2.0), 0.3);
+    vec3 dir = vec3(0.0, 0.0, 1.0);
+
+    float s = 0.1;
+    float fade = 1.0;
+    vec3 v = vec3(0.0);
+    for (int r = 0; r < volsteps; r++) {
+        vec3 p = from + s * dir * 0.5;
+        p = abs(vec3(tile) - mod(p, vec3(tile * 2.0)));
+        float pa = 0.0;
+        float a = 0.0;
+        for (int i = 0; i < iterations; i++) {
+            p = abs(p) / dot(p, p) - formuparam;
+            a += abs(length(p) - pa);
+            pa = length(p);
+        }
+        float dm = max(0.0, darkmatter - a * a * 0.001);
+        a *= a * a;
+        if (r > 6) fade *= 1.0 - dm;
+        v += fade;
+        v += vec3(s, s * s, s * s * s * s) * a * brightness * fade;
+        fade *= distfading;
+        s += stepsize;
+    }
+    v = mix(vec3(length(v)), v, saturation);
+    return half4(saturate(v * 0.01), 1.0);
+}
+)";
+
+// =============================================================================
+// Cache file
+// =============================================================================
+//
+//   FileHeader, then size * size N32 premul pixels (tightly packed)
+//
+// Native endianness and pixel order: the file never leaves the device.
+
+constexpr char kMagic[4] = {'S', 'K', 'S', 'F'};
+constexpr uint32_t kFormatVersion = 1;
+
+struct FileHeader {
+    char magic[4];
+    uint32_t formatVersion;
+    uint32_t size;
+    uint32_t colorType;   // SkColorType of the pixels
+    uint32_t sourceHash;  // FNV-1a of kBakeCode: edits to the shader rebake
+    uint32_t reserved;
+};
+
+uint32_t Fnv1a32(const void* data, size_t size, uint32_t h = 2166136261u) {
+    const auto* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+FileHeader HeaderFor(int size) {
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.formatVersion = kFormatVersion;
+    header.size = static_cast<uint32_t>(size);
+    header.colorType = static_cast<uint32_t>(kN32_SkColorType);
+    header.sourceHash = Fnv1a32(kBakeCode, std::strlen(kBakeCode));
+    return header;
+}
+
+void ReleaseMapping(const void*, void* context) { delete static_cast<MappedFile*>(context); }
+
+// Wraps the mapped pixels without copying; the image owns the mapping.
+sk_sp<SkImage> LoadCache(const std::string& path, int size) {
+    auto file = MappedFile::OpenReadOnly(path);
+    if (!file) return nullptr;
+
+    const FileHeader expected = HeaderFor(size);
+    const size_t rowBytes = static_cast<size_t>(size) * 4;
+    if (file->size() != sizeof(FileHeader) + rowBytes * size ||
+        std::memcmp(file->data(), &expected, sizeof(FileHeader)) != 0) {
+        return nullptr;
+    }
+
+    const SkPixmap pixmap(SkImageInfo::MakeN32(size, size, kOpaque_SkAlphaType),
+                          file->data() + sizeof(FileHeader), rowBytes);
+    MappedFile* mapping = file.release();
+    auto image = SkImages::RasterFromPixmap(pixmap, &ReleaseMapping, mapping);
+    if (!image) delete mapping;
+    return image;
+}
+
+bool StoreCache(const std::string& path, const SkImage& image) {
+    SkPixmap pixmap;
+    if (!image.peekPixels(&pixmap)) return false;
+
+    const FileHeader header = HeaderFor(image.width());
+    const size_t rowBytes = static_cast<size_t>(image.width()) * 4;
+    std::vector<uint8_t> bytes(sizeof(FileHeader) + rowBytes * image.height());
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    const auto* src = static_cast<const uint8_t*>(pixmap.addr());
+    for (int y = 0; y < image.height(); ++y) {
+        std::memcpy(bytes.data() + sizeof(FileHeader) + rowBytes * y, src + pixmap.rowBytes() * y, rowBytes);
+    }
+    return MappedFile::WriteAtomically(path, bytes.data(), bytes.size());
+}
+
+} // namespace
+
+// =============================================================================
+// StarfieldBake
+// =============================================================================
+
+sk_sp<SkImage> StarfieldBake::Bake(int size) {
+    if (size <= 0) return nullptr;
+    auto effect = MakeCachedShaderEffect(kBakeCode);
+    auto surface = SkSurfaces::Raster(SkImageInfo::MakeN32(size, size, kOpaque_SkAlphaType));
+    if (!effect || !surface) return nullptr;
+
+    SkRuntimeShaderBuilder builder(effect);
+    builder.uniform("iResolution") = SkV2{static_cast<float>(size), static_cast<float>(size)};
+    auto shader = builder.makeShader();
+    if (!shader) return nullptr;
+
+    // Same tiling as the CPU video path, all cores: this runs off the
+    // critical path but is still the slowest thing a cold launch does
+    TiledRenderer tiled(TiledRenderer::Config{});
+    const SkRect bounds = SkRect::MakeWH(static_cast<float>(size), static_cast<float>(size));
+    tiled.render(surface->getCanvas(), bounds, [&](SkCanvas* canvas) {
+        SkPaint paint;
+        paint.setShader(shader);
+        canvas->drawRect(bounds, paint);
+    });
+    return surface->makeImageSnapshot();
+}
+
+StarfieldBake::Result StarfieldBake::LoadOrBake(const std::string& cachePath, int size) {
+    Result result;
+    if (!cachePath.empty()) {
+        result.image = LoadCache(cachePath, size);
+        result.fromCache = result.image != nullptr;
+        if (result.image) return result;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    result.image = Bake(size);
+    result.bakeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (result.image && !cachePath.empty()) StoreCache(cachePath, *result.image);
+    return result;
+}
@@ -0,0 +1,39 @@
+// src/StarfieldBake.h
+#pragma once
+
+#include "include/core/SkImage.h"
+#include "include/core/SkRefCnt.h"
+
+#include <string>
+
+// Pre-baked star-nest field for devices that can't afford the live shader.
+//
+// The volume is rendered once with parallel rays along z. The fractal fold
+// repeats every 2 * tile in x and y, so with parallel rays the result is
+// exactly periodic: one period baked into a square texture tiles seamlessly.
+// At runtime SpaceExplorationShader scrolls and rotates it (Mode::kBaked).
+//
+// The bake is cached on disk (raw N32 pixels behind a small header) and
+// memory-mapped on later launches: the returned image wraps the mapping
+// directly, so a cache hit costs an mmap, not a decode or a copy.
+class StarfieldBake {
+public:
+    static constexpr int kDefaultSize = 512;
+
+    struct Result {
+        sk_sp<SkImage> image;   // Raster, opaque; nullptr on failure
+        bool fromCache = false;
+        double bakeMs = 0.0;    // 0 on a cache hit
+    };
+
+    // Loads `cachePath` if it holds a current bake of `size`, otherwise bakes
+    // and (if `cachePath` isn't empty) writes it. CPU only: safe to run on a
+    // worker thread.
+    static Result LoadOrBake(const std::string& cachePath, int size = kDefaultSize);
+
+    // Renders the field without touching the cache.
+    static sk_sp<SkImage> Bake(int size);
+
+    // World-space width of one texture period (2 * tile in the shader).
+    static constexpr float kPeriod = 1.7f;
+};
@@ -0,0 +1,63 @@
+// src/StartupTrace.h
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Wall-clock markers for the launch critical path, relative to process start
+// (the first reading taken in SDL_AppInit). Phases on the main thread are
+// recorded back-to-back with mark(); work moved to background threads reports
+// its own span with record(), so overlap with the main thread stays visible.
+//
+// Thread-safe. Timestamps come from the caller (SDL_GetTicksNS) so this header
+// stays free of SDL.
+class StartupTrace {
+public:
+    struct Phase {
+        std::string name;
+        uint64_t beginNs = 0;   // Relative to launch
+        uint64_t endNs = 0;
+        bool background = false;
+
+        double durationMs() const { return static_cast<double>(endNs - beginNs) / 1e6; }
+        double endMs() const { return static_cast<double>(endNs) / 1e6; }
+    };
+
+    void start(uint64_t nowNs) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        launchNs_ = nowNs;
+        lastMarkNs_ = nowNs;
+        phases_.clear();
+    }
+
+    // Closes the main-thread phase that began at the previous mark().
+    void mark(const char* name, uint64_t nowNs) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        phases_.push_back({name, lastMarkNs_ - launchNs_, nowNs - launchNs_, false});
+        lastMarkNs_ = nowNs;
+    }
+
+    // A span measured elsewhere (typically a background task).
+    void record(const char* name, uint64_t beginNs, uint64_t endNs) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        phases_.push_back({name, beginNs - launchNs_, endNs - launchNs_, true});
+    }
+
+    double sinceLaunchMs(uint64_t nowNs) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return static_cast<double>(nowNs - launchNs_) / 1e6;
+    }
+
+    std::vector<Phase> phases() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return phases_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    uint64_t launchNs_ = 0;
+    uint64_t lastMarkNs_ = 0;
+    std::vector<Phase> phases_;
+};
@@ -0,0 +1,58 @@
+// src/TiledRenderer.cpp
+#include "TiledRenderer.h"
+
+#include "include/core/SkImage.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkPixmap.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+
+TiledRenderer::TiledRenderer(const Config& config)
+    : tileSize_(std::max(config.tileSize, 8))
+    , pool_(config.threads) {}
+
+void TiledRenderer::render(SkCanvas* target, const SkRect& bounds,
+                           const std::function<void(SkCanvas*)>& draw) {
+    const int width = static_cast<int>(std::ceil(bounds.width()));
+    const int height = static_cast<int>(std::ceil(bounds.height()));
+    if (!target || width <= 0 || height <= 0) return;
+
+    if (width != width_ || height != height_) {
+        width_ = width;
+        height_ = height;
+        pixels_.assign(static_cast<size_t>(width) * height, 0);
+    }
+
+    const int columns = (width + tileSize_ - 1) / tileSize_;
+    const int rows = (height + tileSize_ - 1) / tileSize_;
+    const size_t rowBytes = static_cast<size_t>(width) * sizeof(uint32_t);
+
+    const auto start = std::chrono::steady_clock::now();
+    pool_.parallelFor(static_cast<size_t>(columns) * rows, [&](size_t tile) {
+        const int x = static_cast<int>(tile % columns) * tileSize_;
+        const int y = static_cast<int>(tile / columns) * tileSize_;
+        const int w = std::min(tileSize_, width - x);
+        const int h = std::min(tileSize_, height - y);
+
+        // A canvas over just this tile's pixels, positioned in frame space
+        uint32_t* origin = pixels_.data() + static_cast<size_t>(y) * width + x;
+        auto canvas = SkCanvas::MakeRasterDirect(SkImageInfo::MakeN32Premul(w, h), origin, rowBytes);
+        if (!canvas) return;
+        canvas->translate(static_cast<float>(-x), static_cast<float>(-y));
+        draw(canvas.get());
+    });
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    ++stats_.frames;
+    stats_.tiles = columns * rows;
+    stats_.lastMs = ms;
+    stats_.averageMs += (ms - stats_.averageMs) / static_cast<double>(stats_.frames);
+
+    const SkPixmap pixmap(SkImageInfo::MakeN32Premul(width, height), pixels_.data(), rowBytes);
+    if (auto image = SkImages::RasterFromPixmap(pixmap, nullptr, nullptr)) {
+        target->drawImage(image, bounds.left(), bounds.top());
+    }
+}
@@ -0,0 +1,56 @@
+// src/TiledRenderer.h
+#pragma once
+
+#include "WorkStealingPool.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkRect.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Renders expensive per-pixel content (the video shader) on the CPU across
+// several threads: the destination rect is split into tiles, each tile is
+// drawn by a pool worker through its own raster canvas onto its own region
+// of one shared pixel buffer, and the result is composited into the target
+// canvas after all tiles are joined.
+//
+// Tiles never share pixels, so workers don't synchronize while drawing.
+// `draw` is called once per tile, concurrently, with a canvas whose origin is
+// the top-left of the destination rect; it must only read shared state
+// (Skia shaders and runtime effects are safe to use from several threads).
+class TiledRenderer {
+public:
+    struct Config {
+        int tileSize = 64;     // Square tiles, in pixels
+        unsigned threads = 0;  // Including the calling thread; 0 = one per core
+    };
+
+    struct Stats {
+        uint64_t frames = 0;
+        int tiles = 0;          // Per frame, last frame
+        double lastMs = 0.0;    // Tile rendering only (excludes compositing)
+        double averageMs = 0.0;
+    };
+
+    explicit TiledRenderer(const Config& config);
+
+    [[nodiscard]] unsigned threadCount() const { return pool_.threadCount(); }
+    [[nodiscard]] int tileSize() const { return tileSize_; }
+    [[nodiscard]] const Stats& stats() const { return stats_; }
+    void resetStats() { stats_ = {}; }
+
+    // Renders `draw` into `bounds` of `target`. The pixel buffer is reused
+    // across calls and is only rewritten by the next call, so the target must
+    // be flushed once per frame (as the app's frame loop does).
+    void render(SkCanvas* target, const SkRect& bounds, const std::function<void(SkCanvas*)>& draw);
+
+private:
+    int tileSize_;
+    WorkStealingPool pool_;
+    std::vector<uint32_t> pixels_;  // N32 premul, width_ * height_
+    int width_ = 0;
+    int height_ = 0;
+    Stats stats_;
+};
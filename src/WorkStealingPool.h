@@ -0,0 +1,148 @@
+// src/WorkStealingPool.h
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads running index-based batches (parallelFor).
+//
+// Each participant (the workers plus the calling thread) owns a deque. A
+// batch is split into contiguous runs, one per deque, so neighbouring items
+// (e.g. adjacent tiles) tend to stay on one thread. Owners pop from the back
+// of their own deque; a participant that runs dry steals from the front of
+// someone else's, which evens out items of uneven cost.
+//
+// parallelFor() blocks until the batch is done and the caller works on it
+// too. Batches are meant to be issued from one thread at a time.
+class WorkStealingPool {
+public:
+    // `threads` counts all participants including the caller; 0 = one per core.
+    explicit WorkStealingPool(unsigned threads = 0) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        queues_.reserve(threads);
+        for (unsigned i = 0; i < threads; ++i) queues_.push_back(std::make_unique<Queue>());
+        for (unsigned i = 1; i < threads; ++i) workers_.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& t : workers_) t.join();
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    [[nodiscard]] unsigned threadCount() const { return static_cast<unsigned>(queues_.size()); }
+
+    // Runs fn(i) for every i in [0, count). fn may run on any participant.
+    void parallelFor(size_t count, const std::function<void(size_t)>& fn) {
+        if (count == 0) return;
+        if (queues_.size() == 1 || count == 1) {
+            for (size_t i = 0; i < count; ++i) fn(i);
+            return;
+        }
+
+        // Items carry their function, so a worker still finishing its scan
+        // of the previous batch can't run new items with a stale one
+        remaining_.store(count);
+        const size_t participants = queues_.size();
+        for (size_t q = 0; q < participants; ++q) {
+            const size_t begin = count * q / participants;
+            const size_t end = count * (q + 1) / participants;
+            std::lock_guard<std::mutex> lock(queues_[q]->mutex);
+            for (size_t i = begin; i < end; ++i) queues_[q]->items.push_back({&fn, i});
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++batch_;
+        }
+        wake_.notify_all();
+
+        drain(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return remaining_.load() == 0; });
+    }
+
+private:
+    struct Item {
+        const std::function<void(size_t)>* fn;
+        size_t index;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Item> items;
+    };
+
+    bool popOwn(size_t self, Item* item) {
+        Queue& q = *queues_[self];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.items.empty()) return false;
+        *item = q.items.back();
+        q.items.pop_back();
+        return true;
+    }
+
+    bool steal(size_t self, Item* item) {
+        const size_t n = queues_.size();
+        for (size_t k = 1; k < n; ++k) {
+            Queue& q = *queues_[(self + k) % n];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (q.items.empty()) continue;
+            *item = q.items.front();
+            q.items.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    // Runs items until every deque is empty.
+    void drain(size_t self) {
+        Item item{};
+        while (popOwn(self, &item) || steal(self, &item)) {
+            (*item.fn)(item.index);
+            if (remaining_.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                done_.notify_all();
+            }
+        }
+    }
+
+    void workerLoop(size_t self) {
+        uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || batch_ != seen; });
+                if (stop_) return;
+                seen = batch_;
+            }
+            drain(self);
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues_;  // [0] belongs to the caller
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::atomic<size_t> remaining_{0};
+    uint64_t batch_ = 0;
+    bool stop_ = false;
+};
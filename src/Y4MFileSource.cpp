@@ -0,0 +1,296 @@
+// src/Y4MFileSource.cpp
+#include "Y4MFileSource.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+
+namespace {
+
+// =============================================================================
+// YUV4MPEG2 parsing
+// =============================================================================
+//
+//   "YUV4MPEG2 W<w> H<h> F<num>:<den> [I.. A.. C<colorspace> X..]\n"
+//   { "FRAME[ params]\n" <Y plane> <U plane> <V plane> } * N
+
+constexpr std::string_view kStreamMagic = "YUV4MPEG2";
+constexpr std::string_view kFrameMagic = "FRAME";
+constexpr size_t kMaxHeaderBytes = 512;
+
+struct StreamHeader {
+    FrameSource::Info info;
+    size_t dataOffset = 0;  // First FRAME marker
+};
+
+// Y4M doesn't carry the matrix; follow the usual convention of BT.709 for HD
+// and BT.601 for SD.
+FrameSource::Matrix DefaultMatrix(int height) {
+    return height >= 720 ? FrameSource::Matrix::kBT709 : FrameSource::Matrix::kBT601;
+}
+
+bool ParseColorspace(std::string_view c, FrameSource::Chroma* chroma) {
+    // 4:2:0 siting variants all share the same plane layout
+    if (c == "420" || c == "420jpeg" || c == "420paldv" || c == "420mpeg2") {
+        *chroma = FrameSource::Chroma::k420;
+    } else if (c == "422") {
+        *chroma = FrameSource::Chroma::k422;
+    } else if (c == "444") {
+        *chroma = FrameSource::Chroma::k444;
+    } else {
+        return false;  // mono, 444alpha, high bit depth
+    }
+    return true;
+}
+
+bool ParseStreamHeader(const uint8_t* data, size_t size, StreamHeader* out) {
+    const size_t limit = std::min(size, kMaxHeaderBytes);
+    const auto* nl = static_cast<const uint8_t*>(std::memchr(data, '\n', limit));
+    if (!nl) return false;
+
+    std::string_view line(reinterpret_cast<const char*>(data), static_cast<size_t>(nl - data));
+    if (line.substr(0, kStreamMagic.size()) != kStreamMagic) return false;
+    line.remove_prefix(kStreamMagic.size());
+
+    FrameSource::Info info;
+    long rateNum = 0;
+    long rateDen = 0;
+    while (!line.empty()) {
+        const size_t space = line.find(' ');
+        const std::string_view token = line.substr(0, space);
+        line.remove_prefix(space == std::string_view::npos ? line.size() : space + 1);
+        if (token.empty()) continue;
+
+        // Tokens are "<tag><value>"; copy the value to get a terminated string
+        const std::string value(token.substr(1));
+        switch (token[0]) {
+            case 'W': info.width = std::atoi(value.c_str()); break;
+            case 'H': info.height = std::atoi(value.c_str()); break;
+            case 'F': {
+                char* end = nullptr;
+                rateNum = std::strtol(value.c_str(), &end, 10);
+                rateDen = (end && *end == ':') ? std::strtol(end + 1, nullptr, 10) : 0;
+                break;
+            }
+            case 'C':
+                if (!ParseColorspace(value, &info.chroma)) return false;
+                break;
+            case 'X':
+                // ffmpeg writes the range as an extension; anything else is ignored
+                if (value == "COLORRANGE=FULL") info.fullRange = true;
+                break;
+            default:
+                break;  // Interlacing and aspect don't affect layout
+        }
+    }
+
+    if (info.width <= 0 || info.height <= 0 || rateNum <= 0 || rateDen <= 0) return false;
+    info.frameRate = static_cast<double>(rateNum) / static_cast<double>(rateDen);
+    info.matrix = DefaultMatrix(info.height);
+
+    out->info = info;
+    out->dataOffset = static_cast<size_t>(nl - data) + 1;
+    return true;
+}
+
+size_t FrameBytes(const FrameSource::Info& info) {
+    const size_t luma = static_cast<size_t>(info.width) * info.height;
+    const size_t chroma = static_cast<size_t>(info.chromaWidth()) * info.chromaHeight();
+    return luma + 2 * chroma;
+}
+
+// Walks the FRAME markers. Only each marker line is read, so this touches one
+// page per frame rather than the whole file. A truncated last frame is dropped.
+std::vector<uint64_t> IndexFrames(const uint8_t* data, size_t size, size_t offset, size_t frameBytes) {
+    std::vector<uint64_t> offsets;
+    if (frameBytes > 0) offsets.reserve((size - offset) / frameBytes);
+
+    while (size - offset > kFrameMagic.size()) {
+        if (std::memcmp(data + offset, kFrameMagic.data(), kFrameMagic.size()) != 0) break;
+        const size_t limit = std::min(size - offset, kMaxHeaderBytes);
+        const auto* nl = static_cast<const uint8_t*>(std::memchr(data + offset, '\n', limit));
+        if (!nl) break;
+
+        const size_t frame = static_cast<size_t>(nl - data) + 1;
+        if (size - frame < frameBytes) break;
+        offsets.push_back(frame);
+        offset = frame + frameBytes;
+    }
+    return offsets;
+}
+
+} // namespace
+
+// =============================================================================
+// Open
+// =============================================================================
+
+std::unique_ptr<Y4MFileSource> Y4MFileSource::Open(const std::string& path, size_t ringFrames) {
+    auto file = MappedFile::OpenReadOnly(path);
+    if (!file) return nullptr;
+
+    StreamHeader header;
+    if (!ParseStreamHeader(file->data(), file->size(), &header)) return nullptr;
+
+    auto offsets = IndexFrames(file->data(), file->size(), header.dataOffset, FrameBytes(header.info));
+    if (offsets.empty()) return nullptr;
+
+    header.info.frameCount = static_cast<int64_t>(offsets.size());
+    return std::unique_ptr<Y4MFileSource>(
+        new Y4MFileSource(std::move(file), header.info, std::move(offsets), ringFrames));
+}
+
+std::unique_ptr<Y4MFileSource> Y4MFileSource::OpenRawI420(const std::string& path, int width, int height,
+                                                          double frameRate, size_t ringFrames) {
+    if (width <= 0 || height <= 0 || !(frameRate > 0.0)) return nullptr;
+    auto file = MappedFile::OpenReadOnly(path);
+    if (!file) return nullptr;
+
+    Info info;
+    info.width = width;
+    info.height = height;
+    info.chroma = Chroma::k420;
+    info.matrix = DefaultMatrix(height);
+    info.frameRate = frameRate;
+
+    const size_t bytes = FrameBytes(info);
+    const size_t count = file->size() / bytes;
+    if (count == 0) return nullptr;
+
+    std::vector<uint64_t> offsets(count);
+    for (size_t i = 0; i < count; ++i) offsets[i] = i * bytes;
+    info.frameCount = static_cast<int64_t>(count);
+    return std::unique_ptr<Y4MFileSource>(
+        new Y4MFileSource(std::move(file), info, std::move(offsets), ringFrames));
+}
+
+Y4MFileSource::Y4MFileSource(std::unique_ptr<MappedFile> file, const Info& info,
+                             std::vector<uint64_t> offsets, size_t ringFrames)
+    : file_(std::move(file))
+    , info_(info)
+    , offsets_(std::move(offsets))
+    , ring_(std::max<size_t>(ringFrames, 2)) {
+    reader_ = std::thread([this] { readerLoop(); });
+}
+
+Y4MFileSource::~Y4MFileSource() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    reader_.join();
+}
+
+// =============================================================================
+// Frames
+// =============================================================================
+
+size_t Y4MFileSource::frameBytes() const { return FrameBytes(info_); }
+
+VideoFrame Y4MFileSource::frameForIndex(int64_t index) const {
+    VideoFrame f;
+    f.index = index;
+    f.timeSeconds = static_cast<double>(index) / info_.frameRate;
+
+    const size_t lumaBytes = static_cast<size_t>(info_.width) * info_.height;
+    const size_t chromaBytes = static_cast<size_t>(info_.chromaWidth()) * info_.chromaHeight();
+    const uint8_t* y = file_->data() + offsets_[static_cast<size_t>(index)];
+    f.planes[0] = y;
+    f.planes[1] = y + lumaBytes;
+    f.planes[2] = y + lumaBytes + chromaBytes;
+    f.rowBytes[0] = static_cast<size_t>(info_.width);
+    f.rowBytes[1] = f.rowBytes[2] = static_cast<size_t>(info_.chromaWidth());
+    return f;
+}
+
+void Y4MFileSource::readerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        if (count_ == ring_.size() || nextIndex_ >= info_.frameCount) {
+            wake_.wait(lock);
+            continue;
+        }
+        const int64_t index = nextIndex_++;
+        const uint64_t generation = generation_;
+        inFlight_ = index;
+        lock.unlock();
+
+        // The "decode": page the frame in here so the render thread never
+        // stalls on a fault
+        VideoFrame frame = frameForIndex(index);
+        file_->prefetch(offsets_[static_cast<size_t>(index)], frameBytes());
+
+        lock.lock();
+        inFlight_ = -1;
+        if (generation != generation_) continue;  // Seeked meanwhile
+        ring_[(head_ + count_) % ring_.size()] = frame;
+        ++count_;
+    }
+}
+
+void Y4MFileSource::restartAtLocked(int64_t index) {
+    head_ = 0;
+    count_ = 0;
+    nextIndex_ = index;
+    ++generation_;
+    wake_.notify_one();
+}
+
+void Y4MFileSource::seek(double seconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.seeks;
+    restartAtLocked(info_.indexForTime(seconds));
+}
+
+const VideoFrame* Y4MFileSource::frameAt(double seconds) {
+    const int64_t target = info_.indexForTime(seconds);
+    if (current_.index == target) return &current_;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Oldest frame that is buffered or being read, and the newest buffered
+    int64_t front = nextIndex_;
+    if (count_ > 0) front = ring_[head_].index;
+    else if (inFlight_ >= 0) front = inFlight_;
+    const int64_t back = front + static_cast<int64_t>(count_) - 1;
+    const auto capacity = static_cast<int64_t>(ring_.size());
+
+    if (target < front || target > back + capacity) {
+        // Playhead moved without a seek (backwards, or too far ahead for the
+        // reader to catch up): restart there and keep the old frame meanwhile
+        restartAtLocked(target);
+        ++stats_.underruns;
+        return current_.valid() ? &current_ : nullptr;
+    }
+
+    // Release everything up to the target; the reader refills behind it
+    bool advanced = false;
+    while (count_ > 0 && ring_[head_].index <= target) {
+        if (advanced) ++stats_.framesSkipped;
+        current_ = ring_[head_];
+        head_ = (head_ + 1) % ring_.size();
+        --count_;
+        advanced = true;
+    }
+    if (advanced) {
+        ++stats_.framesShown;
+        wake_.notify_one();
+    }
+    if (current_.index != target) ++stats_.underruns;
+    return current_.valid() ? &current_ : nullptr;
+}
+
+size_t Y4MFileSource::queuedTimes(double* pts, size_t max) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const size_t n = std::min(max, count_);
+    for (size_t i = 0; i < n; ++i) pts[i] = ring_[(head_ + i) % ring_.size()].timeSeconds;
+    return n;
+}
+
+FrameSource::Stats Y4MFileSource::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats s = stats_;
+    s.buffered = count_;
+    return s;
+}
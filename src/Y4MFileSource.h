@@ -0,0 +1,81 @@
+// src/Y4MFileSource.h
+#pragma once
+
+#include "FrameSource.h"
+#include "MappedFile.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// FrameSource over a local, uncompressed video file: YUV4MPEG2 (.y4m) or
+// headerless planar I420 (.yuv). A stand-in for a decoder that produces
+// realistic I/O without one.
+//
+// The file is memory-mapped and every frame's data offset is indexed at open,
+// so seeking is an O(1) lookup. A reader thread walks ahead of the playhead,
+// faulting each frame's pages in and queueing it in a bounded ring; frames are
+// never copied, VideoFrame planes point straight into the mapping.
+class Y4MFileSource final : public FrameSource {
+public:
+    static constexpr size_t kDefaultRingFrames = 8;
+
+    // nullptr if the file is missing, malformed or uses an unsupported
+    // colorspace (8-bit 4:2:0, 4:2:2 and 4:4:4 only).
+    static std::unique_ptr<Y4MFileSource> Open(const std::string& path,
+                                               size_t ringFrames = kDefaultRingFrames);
+
+    // Headerless I420 frames back to back (video range); the trailing partial
+    // frame, if any, is ignored.
+    static std::unique_ptr<Y4MFileSource> OpenRawI420(const std::string& path, int width, int height,
+                                                      double frameRate,
+                                                      size_t ringFrames = kDefaultRingFrames);
+
+    ~Y4MFileSource() override;
+
+    Y4MFileSource(const Y4MFileSource&) = delete;
+    Y4MFileSource& operator=(const Y4MFileSource&) = delete;
+
+    // FrameSource
+    [[nodiscard]] const Info& info() const override { return info_; }
+    void seek(double seconds) override;
+    const VideoFrame* frameAt(double seconds) override;
+    size_t queuedTimes(double* pts, size_t max) const override;
+    [[nodiscard]] Stats stats() const override;
+
+private:
+    Y4MFileSource(std::unique_ptr<MappedFile> file, const Info& info, std::vector<uint64_t> offsets,
+                  size_t ringFrames);
+
+    VideoFrame frameForIndex(int64_t index) const;
+    size_t frameBytes() const;
+
+    // Caller holds mutex_. Drops buffered frames and restarts the reader at `index`.
+    void restartAtLocked(int64_t index);
+    void readerLoop();
+
+    std::unique_ptr<MappedFile> file_;
+    Info info_;
+    std::vector<uint64_t> offsets_;  // Start of each frame's Y plane
+
+    // Bounded ring of consecutive frames, oldest at head_
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::vector<VideoFrame> ring_;
+    size_t head_ = 0;
+    size_t count_ = 0;
+    int64_t nextIndex_ = 0;    // Next frame the reader will queue
+    int64_t inFlight_ = -1;    // Frame the reader is paging in, if any
+    uint64_t generation_ = 0;  // Bumped on restart; stale reads are dropped
+    bool stop_ = false;
+    Stats stats_;
+
+    VideoFrame current_;       // Render thread only
+
+    std::thread reader_;
+};
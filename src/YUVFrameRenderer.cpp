@@ -0,0 +1,263 @@
+// src/YUVFrameRenderer.cpp
+#include "YUVFrameRenderer.h"
+
+#include "include/core/SkM44.h"
+#include "include/core/SkMatrix.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkSamplingOptions.h"
+#include "include/gpu/ganesh/GrYUVABackendTextures.h"
+#include "include/gpu/ganesh/SkImageGanesh.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Planes are sampled in luma pixel space; chroma planes are looked up at the
+// scaled position, which matches centered chroma siting.
+constexpr const char* kYUVShader = R"(
+uniform shader yPlane;
+uniform shader uPlane;
+uniform shader vPlane;
+uniform float2 chromaScale;
+uniform float3 rRow;
+uniform float3 gRow;
+uniform float3 bRow;
+uniform float3 bias;
+
+half4 main(float2 p) {
+    float3 yuv = float3(yPlane.eval(p).r,
+                        uPlane.eval(p * chromaScale).r,
+                        vPlane.eval(p * chromaScale).r);
+    float3 rgb = float3(dot(rRow, yuv), dot(gRow, yuv), dot(bRow, yuv)) + bias;
+    return half4(half3(saturate(rgb)), 1.0);
+}
+)";
+
+SkYUVAInfo::Subsampling SubsamplingFor(FrameSource::Chroma chroma) {
+    switch (chroma) {
+        case FrameSource::Chroma::k420: return SkYUVAInfo::Subsampling::k420;
+        case FrameSource::Chroma::k422: return SkYUVAInfo::Subsampling::k422;
+        case FrameSource::Chroma::k444: return SkYUVAInfo::Subsampling::k444;
+    }
+    return SkYUVAInfo::Subsampling::kUnknown;
+}
+
+SkPixmap PlanePixmap(int width, int height, const uint8_t* pixels, size_t rowBytes) {
+    return SkPixmap(SkImageInfo::Make(width, height, kGray_8_SkColorType, kOpaque_SkAlphaType),
+                    pixels, rowBytes);
+}
+
+SkMatrix FrameToRect(const FrameSource::Info& info, const SkRect& dst) {
+    return SkMatrix::Translate(dst.left(), dst.top())
+        .preScale(dst.width() / static_cast<float>(info.width),
+                  dst.height() / static_cast<float>(info.height));
+}
+
+uint8_t ToByte(float v) {
+    return static_cast<uint8_t>(std::clamp(v * 255.0f + 0.5f, 0.0f, 255.0f));
+}
+
+} // namespace
+
+// =============================================================================
+// Colorimetry
+// =============================================================================
+
+YUVFrameRenderer::Conversion YUVFrameRenderer::ConversionFor(FrameSource::Matrix matrix, bool fullRange) {
+    // Luma weights (Kr, Kb); Kg = 1 - Kr - Kb
+    const float kr = matrix == FrameSource::Matrix::kBT709 ? 0.2126f : 0.299f;
+    const float kb = matrix == FrameSource::Matrix::kBT709 ? 0.0722f : 0.114f;
+    const float kg = 1.0f - kr - kb;
+
+    // Video range stores Y in [16, 235] and chroma in [16, 240] (of 255)
+    const float yScale = fullRange ? 1.0f : 255.0f / 219.0f;
+    const float yOffset = fullRange ? 0.0f : 16.0f / 255.0f;
+    const float cScale = fullRange ? 1.0f : 255.0f / 224.0f;
+    const float cOffset = 128.0f / 255.0f;
+
+    // RGB from (Y', Cb, Cr) with Y' in [0, 1] and Cb/Cr in [-0.5, 0.5]
+    const float unit[3][3] = {
+        {1.0f, 0.0f, 2.0f * (1.0f - kr)},
+        {1.0f, -2.0f * kb * (1.0f - kb) / kg, -2.0f * kr * (1.0f - kr) / kg},
+        {1.0f, 2.0f * (1.0f - kb), 0.0f},
+    };
+
+    Conversion c{};
+    for (int row = 0; row < 3; ++row) {
+        c.rows[row] = {unit[row][0] * yScale, unit[row][1] * cScale, unit[row][2] * cScale};
+        c.bias[row] = -(c.rows[row][0] * yOffset + (c.rows[row][1] + c.rows[row][2]) * cOffset);
+    }
+    return c;
+}
+
+SkYUVColorSpace YUVFrameRenderer::ColorSpaceFor(FrameSource::Matrix matrix, bool fullRange) {
+    if (matrix == FrameSource::Matrix::kBT709) {
+        return fullRange ? kRec709_Full_SkYUVColorSpace : kRec709_Limited_SkYUVColorSpace;
+    }
+    return fullRange ? kJPEG_Full_SkYUVColorSpace : kRec601_Limited_SkYUVColorSpace;
+}
+
+// =============================================================================
+// Setup
+// =============================================================================
+
+void YUVFrameRenderer::setFormat(const FrameSource::Info& info) {
+    releaseTextures();
+    info_ = info;
+    conversion_ = ConversionFor(info.matrix, info.fullRange);
+    yuvaInfo_ = SkYUVAInfo({info.width, info.height}, SkYUVAInfo::PlaneConfig::kY_U_V,
+                           SubsamplingFor(info.chroma), ColorSpaceFor(info.matrix, info.fullRange));
+    rgba_.clear();
+    rgba_.shrink_to_fit();
+}
+
+void YUVFrameRenderer::setContext(GrDirectContext* context) {
+    if (context == context_) return;
+    releaseTextures();
+    context_ = context;
+}
+
+void YUVFrameRenderer::releaseTextures() {
+    image_.reset();
+    imageIndex_ = -1;
+    imagePlane_ = nullptr;
+    if (texturesValid_ && context_ && !context_->abandoned()) {
+        for (const auto& texture : planeTextures_) context_->deleteBackendTexture(texture);
+    }
+    planeTextures_ = {};
+    texturesValid_ = false;
+}
+
+// =============================================================================
+// Drawing
+// =============================================================================
+
+bool YUVFrameRenderer::draw(SkCanvas* canvas, const VideoFrame& frame, const SkRect& dst) {
+    if (!canvas || !frame.valid() || info_.width <= 0) return false;
+    if (path_ == Path::kCpuConvert) return drawConverted(canvas, frame, dst);
+    if (!context_) return drawRaster(canvas, frame, dst);
+
+    sk_sp<SkImage> image = gpuImage(frame);
+    if (!image) return false;
+    canvas->drawImageRect(image, dst, SkSamplingOptions(SkFilterMode::kLinear));
+    return true;
+}
+
+sk_sp<SkImage> YUVFrameRenderer::gpuImage(const VideoFrame& frame) {
+    if (image_ && frame.index == imageIndex_ && frame.planes[0] == imagePlane_) return image_;
+    if (context_->abandoned()) return nullptr;
+
+    const int cw = info_.chromaWidth();
+    const int ch = info_.chromaHeight();
+    const int widths[3] = {info_.width, cw, cw};
+    const int heights[3] = {info_.height, ch, ch};
+
+    if (!texturesValid_) {
+        for (int i = 0; i < 3; ++i) {
+            planeTextures_[i] = context_->createBackendTexture(widths[i], heights[i], kGray_8_SkColorType,
+                                                               skgpu::Mipmapped::kNo, GrRenderable::kNo,
+                                                               GrProtected::kNo, "VideoPlane");
+            if (!planeTextures_[i].isValid()) {
+                texturesValid_ = true;  // Let releaseTextures() free the ones that worked
+                releaseTextures();
+                return nullptr;
+            }
+        }
+        texturesValid_ = true;
+    }
+
+    // Same textures every frame: only the pixels move
+    image_.reset();
+    for (int i = 0; i < 3; ++i) {
+        const SkPixmap plane = PlanePixmap(widths[i], heights[i], frame.planes[i], frame.rowBytes[i]);
+        if (!context_->updateBackendTexture(planeTextures_[i], &plane, 1, kTopLeft_GrSurfaceOrigin,
+                                            nullptr, nullptr)) {
+            return nullptr;
+        }
+    }
+
+    const GrYUVABackendTextures textures(yuvaInfo_, planeTextures_.data(), kTopLeft_GrSurfaceOrigin);
+    image_ = SkImages::TextureFromYUVATextures(context_, textures);
+    imageIndex_ = image_ ? frame.index : -1;
+    imagePlane_ = image_ ? frame.planes[0] : nullptr;
+    return image_;
+}
+
+bool YUVFrameRenderer::drawRaster(SkCanvas* canvas, const VideoFrame& frame, const SkRect& dst) {
+    if (!effect_) {
+        auto result = SkRuntimeEffect::MakeForShader(SkString(kYUVShader));
+        effect_ = result.effect;
+        if (!effect_) return false;
+    }
+
+    const int cw = info_.chromaWidth();
+    const int ch = info_.chromaHeight();
+    const SkSamplingOptions linear(SkFilterMode::kLinear);
+
+    // Wrapped in place: the images only reference the frame's planes
+    sk_sp<SkImage> planes[3] = {
+        SkImages::RasterFromPixmap(PlanePixmap(info_.width, info_.height, frame.planes[0], frame.rowBytes[0]),
+                                   nullptr, nullptr),
+        SkImages::RasterFromPixmap(PlanePixmap(cw, ch, frame.planes[1], frame.rowBytes[1]), nullptr, nullptr),
+        SkImages::RasterFromPixmap(PlanePixmap(cw, ch, frame.planes[2], frame.rowBytes[2]), nullptr, nullptr),
+    };
+    for (const auto& plane : planes) {
+        if (!plane) return false;
+    }
+
+    const auto& c = conversion_;
+    SkRuntimeShaderBuilder builder(effect_);
+    builder.child("yPlane") = planes[0]->makeShader(SkTileMode::kClamp, SkTileMode::kClamp, linear);
+    builder.child("uPlane") = planes[1]->makeShader(SkTileMode::kClamp, SkTileMode::kClamp, linear);
+    builder.child("vPlane") = planes[2]->makeShader(SkTileMode::kClamp, SkTileMode::kClamp, linear);
+    builder.uniform("chromaScale") = SkV2{static_cast<float>(cw) / static_cast<float>(info_.width),
+                                          static_cast<float>(ch) / static_cast<float>(info_.height)};
+    builder.uniform("rRow") = SkV3{c.rows[0][0], c.rows[0][1], c.rows[0][2]};
+    builder.uniform("gRow") = SkV3{c.rows[1][0], c.rows[1][1], c.rows[1][2]};
+    builder.uniform("bRow") = SkV3{c.rows[2][0], c.rows[2][1], c.rows[2][2]};
+    builder.uniform("bias") = SkV3{c.bias[0], c.bias[1], c.bias[2]};
+
+    const SkMatrix local = FrameToRect(info_, dst);
+    auto shader = builder.makeShader(&local);
+    if (!shader) return false;
+
+    SkPaint paint;
+    paint.setShader(std::move(shader));
+    canvas->drawRect(dst, paint);
+    return true;
+}
+
+bool YUVFrameRenderer::drawConverted(SkCanvas* canvas, const VideoFrame& frame, const SkRect& dst) {
+    const int w = info_.width;
+    const int h = info_.height;
+    rgba_.resize(static_cast<size_t>(w) * h);
+
+    const int xShift = info_.chroma == FrameSource::Chroma::k444 ? 0 : 1;
+    const int yShift = info_.chroma == FrameSource::Chroma::k420 ? 1 : 0;
+    const auto& c = conversion_;
+    for (int y = 0; y < h; ++y) {
+        const uint8_t* yRow = frame.planes[0] + static_cast<size_t>(y) * frame.rowBytes[0];
+        const uint8_t* uRow = frame.planes[1] + static_cast<size_t>(y >> yShift) * frame.rowBytes[1];
+        const uint8_t* vRow = frame.planes[2] + static_cast<size_t>(y >> yShift) * frame.rowBytes[2];
+        uint32_t* out = rgba_.data() + static_cast<size_t>(y) * w;
+        for (int x = 0; x < w; ++x) {
+            const float yuv[3] = {yRow[x] / 255.0f, uRow[x >> xShift] / 255.0f, vRow[x >> xShift] / 255.0f};
+            uint8_t rgb[3];
+            for (int i = 0; i < 3; ++i) {
+                rgb[i] = ToByte(c.rows[i][0] * yuv[0] + c.rows[i][1] * yuv[1] + c.rows[i][2] * yuv[2] + c.bias[i]);
+            }
+            // kRGBA_8888 in memory order
+            out[x] = static_cast<uint32_t>(rgb[0]) | static_cast<uint32_t>(rgb[1]) << 8 |
+                     static_cast<uint32_t>(rgb[2]) << 16 | 0xFF000000u;
+        }
+    }
+
+    const SkPixmap pixmap(SkImageInfo::Make(w, h, kRGBA_8888_SkColorType, kOpaque_SkAlphaType),
+                          rgba_.data(), static_cast<size_t>(w) * sizeof(uint32_t));
+    auto image = SkImages::RasterFromPixmap(pixmap, nullptr, nullptr);
+    if (!image) return false;
+    canvas->drawImageRect(image, dst, SkSamplingOptions(SkFilterMode::kLinear));
+    return true;
+}
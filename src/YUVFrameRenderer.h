@@ -0,0 +1,82 @@
+// src/YUVFrameRenderer.h
+#pragma once
+
+#include "FrameSource.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkRect.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkYUVAInfo.h"
+#include "include/effects/SkRuntimeEffect.h"
+#include "include/gpu/ganesh/GrBackendSurface.h"
+#include "include/gpu/ganesh/GrDirectContext.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Draws planar YUV frames into a rect, letting Skia convert to RGB while it
+// draws instead of converting on the CPU first.
+//
+//   GPU:    one texture per plane, created for the format and re-uploaded in
+//           place each frame, wrapped as a YUVA image (Skia's YUV->RGB shader).
+//   Raster: the planes are wrapped where they are (no copy) and sampled by a
+//           runtime effect that applies the same matrix.
+//
+// kCpuConvert is the conventional baseline (convert to RGBA, then draw) kept
+// for comparing frame times; see `skplayer_bench yuv`.
+class YUVFrameRenderer {
+public:
+    enum class Path { kSkia, kCpuConvert };
+
+    // Row-wise RGB = coeffs * (Y, U, V) + bias on normalized 8-bit values,
+    // range expansion folded in. Shared by the raster effect and the CPU path.
+    struct Conversion {
+        std::array<std::array<float, 3>, 3> rows;
+        std::array<float, 3> bias;
+    };
+    static Conversion ConversionFor(FrameSource::Matrix matrix, bool fullRange);
+    static SkYUVColorSpace ColorSpaceFor(FrameSource::Matrix matrix, bool fullRange);
+
+    explicit YUVFrameRenderer(Path path = Path::kSkia) : path_(path) {}
+    ~YUVFrameRenderer() { setContext(nullptr); }
+
+    YUVFrameRenderer(const YUVFrameRenderer&) = delete;
+    YUVFrameRenderer& operator=(const YUVFrameRenderer&) = delete;
+
+    // Frame layout and colorimetry; plane textures are (re)created lazily.
+    void setFormat(const FrameSource::Info& info);
+
+    // GPU context the canvas draws with, or nullptr for raster. Call again
+    // after the context is recreated; textures of a live context are freed.
+    void setContext(GrDirectContext* context);
+
+    [[nodiscard]] Path path() const { return path_; }
+
+    // False if the frame couldn't be drawn (no format, upload failure).
+    bool draw(SkCanvas* canvas, const VideoFrame& frame, const SkRect& dst);
+
+private:
+    sk_sp<SkImage> gpuImage(const VideoFrame& frame);
+    bool drawRaster(SkCanvas* canvas, const VideoFrame& frame, const SkRect& dst);
+    bool drawConverted(SkCanvas* canvas, const VideoFrame& frame, const SkRect& dst);
+    void releaseTextures();
+
+    Path path_;
+    FrameSource::Info info_;
+    SkYUVAInfo yuvaInfo_;
+    Conversion conversion_{};
+
+    GrDirectContext* context_ = nullptr;
+    std::array<GrBackendTexture, 3> planeTextures_;
+    bool texturesValid_ = false;
+
+    // Last uploaded frame: a paused video re-draws without re-uploading
+    sk_sp<SkImage> image_;
+    int64_t imageIndex_ = -1;
+    const uint8_t* imagePlane_ = nullptr;
+
+    sk_sp<SkRuntimeEffect> effect_;
+    std::vector<uint32_t> rgba_;  // kCpuConvert only, reused across frames
+};
@@ -4,9 +4,22 @@
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_main.h>
 
+#include "skplayer_ui/ChapterImport.h"
+#include "skplayer_ui/MemoryGovernor.h"
+#include "skplayer_ui/ResourceContext.h"
 #include "skplayer_ui/VideoContainer.h"
+#include "FrameSource.h"
+#include "MappedFile.h"
+#include "PresentationScheduler.h"
+#include "ProgramCache.h"
+#include "SkiaMemoryCaches.h"
 #include "SpaceExplorationShader.h"
+#include "StarfieldBake.h"
+#include "StartupTrace.h"
+#include "Y4MFileSource.h"
+#include "YUVFrameRenderer.h"
 #include "skplayer_ui/ThemeConstants.h"
+#include "skplayer_ui/Trace.h"
 #include "OverlayTypefaceProvider.h"
 
 #include "include/core/SkCanvas.h"
@@ -15,6 +28,7 @@
 #include "include/core/SkSurface.h"
 #include "include/core/SkTypeface.h"
 #include "include/gpu/ganesh/GrBackendSurface.h"
+#include "include/gpu/ganesh/GrContextOptions.h"
 #include "include/gpu/ganesh/GrDirectContext.h"
 #include "include/gpu/ganesh/GrTypes.h"
 #include "include/gpu/ganesh/SkSurfaceGanesh.h"
@@ -24,8 +38,15 @@
 #include "include/gpu/ganesh/gl/GrGLTypes.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <future>
+#include <iterator>
 #include <memory>
+#include <string>
 
 #ifdef __ANDROID__
 #include <android/log.h>
@@ -47,12 +68,60 @@
 // Video duration in seconds (matches the shader animation loop feel)
 static constexpr float kVideoDurationSeconds = 194.0f;
 
+// Live demo: a new chapter ("segment") starts this often at the live edge
+static constexpr int kLiveSegmentSeconds = 30;
+
+// Frame rates for the container's modes: the shader "video" is treated as
+// 60 fps content, and paused fades run at the low rate
+static constexpr float kShaderContentHz = 60.0f;
+static constexpr float kLowFrameRateHz = 30.0f;
+
+// Optional video file from the command line:
+//   <app> clip.y4m
+//   <app> clip.yuv 1280x720@30     (headerless I420)
+// Without one (or if it can't be opened) the shader stands in for the video.
+static std::unique_ptr<FrameSource> OpenFrameSource(int argc, char* argv[]) {
+    if (argc < 2) return nullptr;
+    const std::string path = argv[1];
+
+    std::unique_ptr<FrameSource> source;
+    if (argc >= 3) {
+        int width = 0, height = 0;
+        double fps = 0.0;
+        if (std::sscanf(argv[2], "%dx%d@%lf", &width, &height, &fps) == 3) {
+            source = Y4MFileSource::OpenRawI420(path, width, height, fps);
+        }
+    } else {
+        source = Y4MFileSource::Open(path);
+    }
+    return source;
+}
+
+// Optional chapter list: SKPLAYER_CHAPTERS=<file> (WebVTT, JSON or
+// "00:00 Title" description text)
+static bool ImportChapterFile(const char* path, std::vector<skplayer_ui::Chapter>& out) {
+    auto file = MappedFile::OpenReadOnly(path);
+    if (!file) {
+        LOG("Could not open chapter file '%s'", path);
+        return false;
+    }
+    const auto result = skplayer_ui::ImportChapters(reinterpret_cast<const char*>(file->data()), file->size(), out);
+    if (!result.ok) {
+        LOG("Chapter file '%s': %s (line %zu)", path, result.error, result.errorLine);
+        return false;
+    }
+    LOG("Chapters: %zu from '%s'", result.chapters, path);
+    return true;
+}
+
 struct AppState : public skplayer_ui::VideoContainer::Listener {
     std::unique_ptr<SDL_Window, decltype(&SDL_DestroyWindow)> window{nullptr, SDL_DestroyWindow};
     std::unique_ptr<std::remove_pointer_t<SDL_GLContext>, decltype(&SDL_GL_DestroyContext)> gl{nullptr, SDL_GL_DestroyContext};
 
     sk_sp<const GrGLInterface> glInterface;
     sk_sp<GrDirectContext> grContext;
+    GrContextOptions contextOptions;  // Reused when the context is recreated
+    ProgramCache programCache;
     sk_sp<SkSurface> surface;
     sk_sp<SkTypeface> overlayTypeface;
 
@@ -60,14 +129,72 @@ struct AppState : public skplayer_ui::VideoContainer::Listener {
     int height = 0;
     float dpiScale = 1.0f;
     Uint64 lastTime = 0;
+    bool firstFramePresented = false;
+    bool needsFrame = true;  // An event arrived since the last rendered frame
 
-    // Video simulation
+    // Video: frames from a file, or the shader as a stand-in
+    std::unique_ptr<FrameSource> frameSource;
+    std::unique_ptr<YUVFrameRenderer> yuvRenderer;
     SpaceExplorationShader spaceShader;
+    skplayer_ui::MediaTimeUs durationUs = skplayer_ui::media_time::fromSeconds(kVideoDurationSeconds);
+    float videoAspect = 16.0f / 9.0f;
     bool isPlaying = false;  // Start paused until loading completes
-    float videoTime = 0.0f;  // Current playback time
+    skplayer_ui::MediaTimeUs videoTimeUs = 0;  // Current playback time, advanced by the integer tick clock
+    bool videoDrawn = false; // The last frame contained video
+
+    // SKPLAYER_LIVE_WINDOW=<seconds> (shader video only): a live stream whose
+    // edge is the time since launch, seekable over the last <seconds>.
+    float liveWindowSeconds = 0.0f;  // 0 = VOD
+    Uint64 liveStartMs = 0;
+    int liveEdgeSecond = -1;         // Edge last pushed to the container
+    int liveSegments = 0;
+
+    // Frame pacing against the display clock (file frames only)
+    PresentationScheduler presenter;
+    struct Presentation {
+        int64_t frameIndex = -1;
+        double framePts = 0.0;
+        double mediaTimeAtVsync = 0.0;
+    } pendingPresent;
+    int64_t shownFrameIndex = -1;
+    double shownFramePts = 0.0;
 
     // UI
+    std::shared_ptr<skplayer_ui::ResourceContext> uiResources;
     std::unique_ptr<skplayer_ui::VideoContainer> videoContainer;
+    bool pointerPrediction = true;  // Drag preview aimed at the next vsync
+
+    // Snapshot for instant resume if the process is killed in the
+    // background: taken on the UI thread, written by a worker
+    std::string snapshotPath;
+    std::future<bool> pendingSnapshotWrite;
+
+    // SKPLAYER_TRACE=<file>: library trace events written here at quit
+    std::string tracePath;
+
+    // Swap interval chosen from the container's frame-rate mode
+    skplayer_ui::FrameRates frameRates;
+    skplayer_ui::FrameRateMode frameRateMode = skplayer_ui::FrameRateMode::Max;
+    float panelHz = 60.0f;
+    int swapInterval = 1;
+
+    // Startup: shader compilation and typeface loading run off the critical
+    // path. The first frame shows the UI; the video appears once its shader
+    // is ready and text switches to the platform typeface when it arrives.
+    // Declared after everything the tasks touch, so their (joining) futures
+    // are destroyed first.
+    StartupTrace startup;
+    std::atomic<Uint32> startupEvent{0};  // Wakes the idle loop when a task finishes
+    std::future<sk_sp<SkRuntimeEffect>> pendingShader;
+    std::future<sk_sp<SkTypeface>> pendingTypeface;
+    std::future<StarfieldBake::Result> pendingStarfield;  // Baked shader mode only
+    bool startupReported = false;
+
+    // Memory budget across Skia and library caches
+    std::unique_ptr<skplayer_ui::MemoryGovernor> memory;
+    GpuResourceCache gpuCache;
+    SkiaFontCache fontCache;
+    SkiaRasterCache rasterCache;
 
     // Layout
     SkRect videoBounds = SkRect::MakeEmpty();
@@ -140,9 +267,9 @@ struct AppState : public skplayer_ui::VideoContainer::Listener {
         const float portraitTopMargin = skplayer_ui::theme::layout::kPortraitTopMarginDp * dpiScale;
         
         if (isPortrait) {
-            // Portrait: top margin for cutout, then video (16:9), then seekbar below
+            // Portrait: top margin for cutout, then video, then seekbar below
             float videoWidth = static_cast<float>(width);
-            float videoHeight = videoWidth * 9.0f / 16.0f;  // 16:9 aspect ratio
+            float videoHeight = videoWidth / videoAspect;
             
             // Video starts below the top margin
             videoBounds = SkRect::MakeXYWH(0, portraitTopMargin, videoWidth, videoHeight);
@@ -154,17 +281,16 @@ struct AppState : public skplayer_ui::VideoContainer::Listener {
             float screenWidth = static_cast<float>(width);
             float screenHeight = static_cast<float>(height);
             
-            // Fit 16:9 video to screen (letterbox if needed)
-            float videoAspect = 16.0f / 9.0f;
+            // Fit video to screen (letterbox if needed)
             float screenAspect = screenWidth / screenHeight;
             
             float videoWidth, videoHeight;
             if (screenAspect > videoAspect) {
-                // Screen is wider than 16:9 - fit to height
+                // Screen is wider than the video - fit to height
                 videoHeight = screenHeight;
                 videoWidth = videoHeight * videoAspect;
             } else {
-                // Screen is taller than 16:9 - fit to width
+                // Screen is taller than the video - fit to width
                 videoWidth = screenWidth;
                 videoHeight = videoWidth / videoAspect;
             }
@@ -194,6 +320,295 @@ struct AppState : public skplayer_ui::VideoContainer::Listener {
         }
     }
 
+    // Runs `task` on a worker thread, records its span in the startup trace
+    // and wakes the main loop when done.
+    template <typename T, typename Fn>
+    std::future<T> runStartupTask(const char* name, Fn task) {
+        return std::async(std::launch::async, [this, name, task]() -> T {
+            const Uint64 begin = SDL_GetTicksNS();
+            T result = task();
+            startup.record(name, begin, SDL_GetTicksNS());
+            if (const Uint32 type = startupEvent.load()) {
+                SDL_Event event{};
+                event.type = type;
+                SDL_PushEvent(&event);
+            }
+            return result;
+        });
+    }
+
+    template <typename T>
+    static bool isReady(const std::future<T>& f) {
+        return f.valid() && f.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    // Adopts finished startup work. Returns false if the shader failed.
+    bool collectStartupTasks() {
+        if (isReady(pendingShader)) {
+            spaceShader.setEffect(pendingShader.get());
+            if (!spaceShader.isReady()) {
+                LOG("Failed to initialize shader");
+                return false;
+            }
+            needsFrame = true;
+        }
+        if (isReady(pendingTypeface)) {
+            overlayTypeface = pendingTypeface.get();
+            if (!overlayTypeface) {
+                LOG("Warning: Failed to load overlay typeface, using Skia's default");
+            }
+            uiResources->setTypeface(overlayTypeface.get());
+            needsFrame = true;
+        }
+        if (isReady(pendingStarfield)) {
+            const auto bake = pendingStarfield.get();
+            if (!bake.image) {
+                LOG("Starfield bake failed - staying on the live shader");
+            } else if (bake.fromCache) {
+                LOG("Starfield: %d px field mapped from cache", bake.image->width());
+            } else {
+                LOG("Starfield: %d px field baked in %.1f ms", bake.image->width(), bake.bakeMs);
+            }
+            spaceShader.setBakedField(bake.image);
+            needsFrame = true;
+        }
+        return true;
+    }
+
+    // Loads the baked field from the app's data directory, baking it there
+    // on first use. Runs in the background; the live shader draws meanwhile.
+    void startStarfieldBake() {
+        if (pendingStarfield.valid() || spaceShader.hasBakedField()) return;
+        std::string cachePath;
+        if (char* prefPath = SDL_GetPrefPath("skplayer", "SkiaSeekBar")) {
+            cachePath = std::string(prefPath) + "starfield.bin";
+            SDL_free(prefPath);
+        }
+        pendingStarfield = runStartupTask<StarfieldBake::Result>(
+            "starfield bake", [cachePath] { return StarfieldBake::LoadOrBake(cachePath); });
+    }
+
+    [[nodiscard]] bool startupPending() const {
+        return pendingShader.valid() || pendingTypeface.valid() || pendingStarfield.valid();
+    }
+
+    void logStartup() {
+        LOG("Startup (ms since launch):");
+        for (const auto& phase : startup.phases()) {
+            LOG("  %-18s %8.2f -> %8.2f  (%7.2f)%s", phase.name.c_str(),
+                static_cast<double>(phase.beginNs) / 1e6, phase.endMs(), phase.durationMs(),
+                phase.background ? "  [worker]" : "");
+        }
+        const auto& pc = programCache.stats();
+        if (contextOptions.fPersistentCache) {
+            LOG("  program cache: %u hits, %u misses, %u stores", pc.hits, pc.misses, pc.stores);
+        } else {
+            LOG("  program cache disabled");
+        }
+    }
+
+    // Draws the video for the upcoming vsync: a file frame, or the shader.
+    void renderVideo(SkCanvas* canvas, bool advancing) {
+        videoDrawn = false;
+        pendingPresent.frameIndex = -1;
+        if (frameSource) {
+            // Aim at the media time that will be current when this frame is
+            // on screen, not at the time of this callback
+            const double nowSeconds = static_cast<double>(SDL_GetTicksNS()) / 1e9;
+            const double vsync = presenter.predictNextVsync(nowSeconds);
+            const double mediaTime = skplayer_ui::media_time::toSeconds(videoTimeUs) +
+                                     (advancing ? vsync - nowSeconds : 0.0);
+
+            double queued[Y4MFileSource::kDefaultRingFrames];
+            const size_t count = frameSource->queuedTimes(queued, std::size(queued));
+            const int pick = presenter.choose(queued, count, mediaTime);
+            double request = mediaTime;
+            if (pick >= 0) request = queued[pick];
+            else if (count > 0 && shownFrameIndex >= 0) request = shownFramePts;  // Next one not due yet
+
+            const auto& info = frameSource->info();
+            const VideoFrame* frame = frameSource->frameAt(request);
+            // Still buffering (e.g. just after a seek): come back next vsync
+            if (!frame || frame->index != info.indexForTime(mediaTime)) needsFrame = true;
+            if (!frame) return;
+            videoDrawn = yuvRenderer->draw(canvas, *frame, videoBounds);
+            if (videoDrawn) {
+                pendingPresent = {frame->index, frame->timeSeconds, mediaTime};
+                shownFrameIndex = frame->index;
+                shownFramePts = frame->timeSeconds;
+            }
+        } else if (spaceShader.isReady()) {
+            spaceShader.render(canvas, videoBounds);
+            videoDrawn = true;
+        }
+    }
+
+    // After the swap: feed the display clock and account the shown frame.
+    void onFramePresented(bool videoAdvanced) {
+        presenter.onVsync(static_cast<double>(SDL_GetTicksNS()) / 1e9, swapInterval);
+        if (pendingPresent.frameIndex < 0) return;
+        if (!videoAdvanced) {
+            // Paused or loading: repeats are expected, not duplicates
+            presenter.resetTimeline();
+            return;
+        }
+        presenter.onPresented(pendingPresent.frameIndex, pendingPresent.framePts,
+                              pendingPresent.mediaTimeAtVsync, 1.0 / frameSource->info().frameRate);
+    }
+
+    // Whole vsyncs per frame landing within 5% of `hz`. Rates that don't
+    // divide the panel's (24 fps at 60 Hz) get every vsync.
+    [[nodiscard]] int swapIntervalFor(float hz) const {
+        if (hz <= 0.0f) return swapInterval;  // Idle: no frames to pace
+        const int n = std::max(1, static_cast<int>(std::lround(panelHz / hz)));
+        return std::abs(panelHz / static_cast<float>(n) - hz) <= hz * 0.05f ? n : 1;
+    }
+
+    // After update(): follow the container's mode, logging each change
+    void applyFrameRate() {
+        const auto mode = videoContainer->frameRateMode();
+        if (mode == frameRateMode) return;
+        frameRateMode = mode;
+
+        const int interval = swapIntervalFor(frameRates.hz(mode));
+        if (interval != swapInterval && SDL_GL_SetSwapInterval(interval)) swapInterval = interval;
+        if (mode == skplayer_ui::FrameRateMode::Idle) {
+            LOG("Frame rate: idle (no frames until input or a timer)");
+        } else {
+            LOG("Frame rate: %s, %.1f Hz (swap interval %d)", skplayer_ui::FrameRateModeName(mode),
+                panelHz / static_cast<float>(swapInterval), swapInterval);
+        }
+    }
+
+    void saveSnapshot() {
+        if (snapshotPath.empty() || !videoContainer) return;
+        if (pendingSnapshotWrite.valid()) pendingSnapshotWrite.wait();
+        pendingSnapshotWrite = std::async(std::launch::async,
+            [path = snapshotPath, bytes = videoContainer->snapshot()] {
+                return MappedFile::WriteAtomically(path, bytes.data(), bytes.size());
+            });
+    }
+
+    // The session survived the background (or is quitting normally): the
+    // snapshot is only for a process killed while backgrounded
+    void discardSnapshot() {
+        if (snapshotPath.empty()) return;
+        if (pendingSnapshotWrite.valid()) pendingSnapshotWrite.wait();
+        std::remove(snapshotPath.c_str());
+    }
+
+    // Consumes the snapshot left by a killed background session, like
+    // Android's saved instance state
+    void restoreSnapshot() {
+        auto file = MappedFile::OpenReadOnly(snapshotPath);
+        if (!file) return;
+        const Uint64 start = SDL_GetTicksNS();
+        const bool ok = videoContainer->restore(file->data(), file->size(), SDL_GetTicks());
+        const double ms = static_cast<double>(SDL_GetTicksNS() - start) / 1e6;
+        std::remove(snapshotPath.c_str());
+        if (!ok) {
+            LOG("Resume snapshot rejected (other version or damaged)");
+            return;
+        }
+        setVideoTime(videoContainer->positionUs());
+        isPlaying = videoContainer->isPlaying() && !videoContainer->isLoading();
+        LOG("Resumed at %.1f s from a %zu byte snapshot in %.3f ms",
+            skplayer_ui::media_time::toSeconds(videoTimeUs), file->size(), ms);
+    }
+
+    // Input-to-photon latency per interaction (event timestamp to the swap
+    // that showed its effect); L key and quit
+    void logInputLatency() const {
+        for (size_t i = 0; i < skplayer_ui::kInteractionCount; ++i) {
+            const auto kind = static_cast<skplayer_ui::Interaction>(i);
+            const auto s = videoContainer->inputLatency(kind);
+            if (s.count == 0) continue;
+            LOG("Input latency (%s): %u samples, mean %.1f ms, p50 %.1f, p95 %.1f, p99 %.1f, max %.1f ms",
+                skplayer_ui::InteractionName(kind), s.count, s.meanMs, s.p50Ms, s.p95Ms, s.p99Ms, s.maxMs);
+        }
+    }
+
+    // What the UI costs (VideoContainer::stats(), the counters a production
+    // build would sample for telemetry): the last frame and the per-frame
+    // average so far; S key and quit
+    void logUIStats() const {
+        const skplayer_ui::ContainerStats s = videoContainer->stats();
+        const skplayer_ui::StatsCounters& f = s.lastFrame;
+        const skplayer_ui::StatsCounters& t = s.total;
+        if (t.frames == 0) return;
+        const double n = static_cast<double>(t.frames);
+        LOG("UI last frame: %llu draws, %llu paths, %llu measured, %llu shaped, %llu allocs, "
+            "%llu transitions, %llu callbacks, update %.3f ms, render %.3f ms",
+            static_cast<unsigned long long>(f.totalDrawCalls()), static_cast<unsigned long long>(f.pathsBuilt),
+            static_cast<unsigned long long>(f.textMeasurements), static_cast<unsigned long long>(f.textShapings),
+            static_cast<unsigned long long>(f.allocations), static_cast<unsigned long long>(f.stateTransitions),
+            static_cast<unsigned long long>(f.listenerCallbacks), f.updateNs / 1e6, f.renderNs / 1e6);
+        LOG("UI per frame over %llu frames: %.2f draws, %.3f paths, %.3f measured, %.3f shaped, %.3f allocs, "
+            "update %.3f ms, render %.3f ms",
+            static_cast<unsigned long long>(t.frames), t.totalDrawCalls() / n, t.pathsBuilt / n,
+            t.textMeasurements / n, t.textShapings / n, t.allocations / n, t.updateNs / 1e6 / n, t.renderNs / 1e6 / n);
+        for (size_t i = 0; i < skplayer_ui::kComponentCount; ++i) {
+            const auto c = static_cast<skplayer_ui::Component>(i);
+            LOG("  %s: %llu draws last frame, %.2f per frame", skplayer_ui::ComponentName(c),
+                static_cast<unsigned long long>(f.drawCallsFor(c)), t.drawCallsFor(c) / n);
+        }
+    }
+
+    // Chrome trace JSON of the session (needs SKPLAYER_UI_ENABLE_TRACING)
+    void exportTrace() const {
+        if (tracePath.empty()) return;
+        if (!skplayer_ui::kTracingCompiledIn) {
+            LOG("SKPLAYER_TRACE ignored: configure with -DSKPLAYER_UI_ENABLE_TRACING=ON");
+        } else if (skplayer_ui::ExportTrace(tracePath.c_str())) {
+            LOG("Trace written to %s", tracePath.c_str());
+        } else {
+            LOG("Could not write trace to %s", tracePath.c_str());
+        }
+    }
+
+    // Q key: next shader quality tier
+    void cycleShaderQuality() {
+        const int next = (static_cast<int>(spaceShader.quality()) + 1) % SpaceExplorationShader::kQualityCount;
+        spaceShader.setQuality(static_cast<SpaceExplorationShader::Quality>(next));
+        const auto tier = SpaceExplorationShader::TierFor(spaceShader.quality());
+        LOG("Shader quality: %s (%d iterations, %d volume steps)", tier.name, tier.iterations, tier.volsteps);
+    }
+
+    // B key: live shader <-> baked field
+    void toggleShaderMode() {
+        const bool baked = spaceShader.mode() != SpaceExplorationShader::Mode::kBaked;
+        spaceShader.setMode(baked ? SpaceExplorationShader::Mode::kBaked : SpaceExplorationShader::Mode::kLive);
+        if (baked) startStarfieldBake();
+        LOG("Shader mode: %s", baked ? "baked" : "live");
+    }
+
+    void logFrameSourceStats() const {
+        if (!frameSource) return;
+        const auto s = frameSource->stats();
+        LOG("Frames: %llu shown, %llu skipped, %llu underruns, %llu seeks",
+            static_cast<unsigned long long>(s.framesShown), static_cast<unsigned long long>(s.framesSkipped),
+            static_cast<unsigned long long>(s.underruns), static_cast<unsigned long long>(s.seeks));
+
+        const auto p = presenter.stats();
+        LOG("Presentation at %.2f Hz: %llu presented, %llu dropped, %llu duplicated, %llu missed vsyncs",
+            p.refreshHz, static_cast<unsigned long long>(p.presented), static_cast<unsigned long long>(p.dropped),
+            static_cast<unsigned long long>(p.duplicated), static_cast<unsigned long long>(p.missedVsyncs));
+        LOG("  judder %.2f ms mean, %.2f ms stddev, %.2f ms max; cadence 1:%llu 2:%llu 3:%llu 4+:%llu",
+            p.judderMeanMs, p.judderStdDevMs, p.judderMaxMs,
+            static_cast<unsigned long long>(p.cadence[0]), static_cast<unsigned long long>(p.cadence[1]),
+            static_cast<unsigned long long>(p.cadence[2]), static_cast<unsigned long long>(p.cadence[3]));
+    }
+
+    void logMemoryStats(const char* reason) const {
+        if (!memory) return;
+        auto stats = memory->stats();
+        LOG("Memory (%s): tier %d, %zu / %zu KB", reason, static_cast<int>(stats.tier),
+            stats.bytesUsed / 1024, stats.budget / 1024);
+        for (const auto& c : stats.caches) {
+            LOG("  %-22s %8zu / %8zu KB", c.name.c_str(), c.bytesUsed / 1024, c.budget / 1024);
+        }
+    }
+
     // VideoContainer::Listener callbacks
     void onPlay() override {
         isPlaying = true;
@@ -205,22 +620,99 @@ struct AppState : public skplayer_ui::VideoContainer::Listener {
         LOG("Pause");
     }
 
-    void onSeekTo(float positionSeconds) override {
-        videoTime = std::clamp(positionSeconds, 0.0f, kVideoDurationSeconds);
-        spaceShader.setTime(videoTime);
-        LOG("Seek to: %.1f", positionSeconds);
+    // Slides the live window once per second of stream time and appends a
+    // chapter at each segment boundary. True when the window moved.
+    bool updateLiveWindow(Uint64 nowMs) {
+        if (liveWindowSeconds <= 0.0f) return false;
+        const int edge = static_cast<int>((nowMs - liveStartMs) / 1000);
+        if (edge == liveEdgeSecond) return false;
+        liveEdgeSecond = edge;
+        while (liveSegments * kLiveSegmentSeconds <= edge) {
+            const int start = liveSegments * kLiveSegmentSeconds;
+            videoContainer->appendChapter(skplayer_ui::Chapter::AtUs(start * skplayer_ui::media_time::kPerSecond,
+                                                                     "Segment " + std::to_string(++liveSegments)));
+        }
+        videoContainer->setLiveWindow(std::max(0.0f, static_cast<float>(edge) - liveWindowSeconds),
+                                      static_cast<float>(edge));
+        return true;
+    }
+
+    // Playback can't run past this: the end of the video, or the live edge
+    skplayer_ui::MediaTimeUs playbackEnd() const {
+        if (liveWindowSeconds <= 0.0f) return durationUs;
+        return std::max(liveEdgeSecond, 0) * skplayer_ui::media_time::kPerSecond;
+    }
+
+    void setVideoTime(skplayer_ui::MediaTimeUs t) {
+        videoTimeUs = t;
+        spaceShader.setTime(static_cast<float>(skplayer_ui::media_time::toSeconds(t)));
+    }
+
+    void onCuePoint(const skplayer_ui::CuePoint& cue) override {
+        LOG("Cue %u at %.1f", cue.id, cue.time);
+    }
+
+    void onSeekToUs(skplayer_ui::MediaTimeUs positionUs) override {
+        setVideoTime(std::clamp<skplayer_ui::MediaTimeUs>(positionUs, 0, playbackEnd()));
+        if (frameSource) frameSource->seek(skplayer_ui::media_time::toSeconds(videoTimeUs));
+        presenter.resetTimeline();
+        LOG("Seek to: %.3f", skplayer_ui::media_time::toSeconds(positionUs));
     }
 };
 
-SDL_AppResult SDL_AppInit(void** appstate, int /*argc*/, char* /*argv*/[]) {
+SDL_AppResult SDL_AppInit(void** appstate, int argc, char* argv[]) {
     LOG("=== Starting Skia Space Exploration Demo ===");
 
+
     auto state = std::make_unique<AppState>();
+    state->startup.start(SDL_GetTicksNS());
+
+    // Mapping and indexing the file is cheap; frames are read on demand
+    state->frameSource = OpenFrameSource(argc, argv);
+    if (state->frameSource) {
+        const auto& info = state->frameSource->info();
+        state->durationUs = skplayer_ui::media_time::fromSeconds(info.durationSeconds());
+        state->videoAspect = static_cast<float>(info.width) / static_cast<float>(info.height);
+        LOG("Video file: %d x %d, %lld frames at %.3f fps", info.width, info.height,
+            static_cast<long long>(info.frameCount), info.frameRate);
+        state->yuvRenderer = std::make_unique<YUVFrameRenderer>();
+        state->yuvRenderer->setFormat(info);
+    } else if (argc >= 2) {
+        LOG("Could not open video file '%s' - using the shader", argv[1]);
+    }
+    state->startup.mark("frame source", SDL_GetTicksNS());
+
+    // SKPLAYER_SHADER_QUALITY=low|medium|high|ultra picks the starting tier
+    if (const char* quality = std::getenv("SKPLAYER_SHADER_QUALITY")) {
+        SpaceExplorationShader::Quality q;
+        if (SpaceExplorationShader::ParseQuality(quality, &q)) {
+            state->spaceShader.setQuality(q);
+        } else {
+            LOG("Unknown SKPLAYER_SHADER_QUALITY '%s' - using ultra", quality);
+        }
+    }
+
+    // Neither task needs SDL video or a GL context, so start them first
+    if (!state->frameSource) {
+        state->pendingShader = state->runStartupTask<sk_sp<SkRuntimeEffect>>(
+            "shader compile", &SpaceExplorationShader::Compile);
+    }
+    state->pendingTypeface = state->runStartupTask<sk_sp<SkTypeface>>(
+        "typeface load", &CreateDefaultOverlayTypeface);
+    // SKPLAYER_SHADER_MODE=baked: scroll a pre-baked field instead of running
+    // the volume shader per pixel (the B key switches at runtime)
+    const char* shaderMode = std::getenv("SKPLAYER_SHADER_MODE");
+    if (!state->frameSource && shaderMode && std::string(shaderMode) == "baked") {
+        state->spaceShader.setMode(SpaceExplorationShader::Mode::kBaked);
+        state->startStarfieldBake();
+    }
 
     if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS)) {
         LOG("SDL_Init failed: %s", SDL_GetError());
         return SDL_APP_FAILURE;
     }
+    state->startupEvent = SDL_RegisterEvents(1);
+    state->startup.mark("sdl init", SDL_GetTicksNS());
 
     // OpenGL ES 3.0
     if (!SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_ES)) {
@@ -259,6 +751,19 @@ SDL_AppResult SDL_AppInit(void** appstate, int /*argc*/, char* /*argv*/[]) {
     if (!SDL_GL_SetSwapInterval(1)) {
         LOG("Warning: VSync not available: %s", SDL_GetError());
     }
+    state->startup.mark("window + gl", SDL_GetTicksNS());
+
+    // Panel rate, for the frame-rate policy's swap intervals. File frames
+    // keep every vsync: the PresentationScheduler paces them itself.
+    const SDL_DisplayMode* displayMode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(state->window.get()));
+    if (displayMode && displayMode->refresh_rate > 0.0f) state->panelHz = displayMode->refresh_rate;
+    state->frameRates.maxHz = state->panelHz;
+    state->frameRates.contentHz = state->frameSource ? state->panelHz : kShaderContentHz;
+    state->frameRates.lowHz = kLowFrameRateHz;
+    LOG("Display: %.2f Hz", state->panelHz);
+    PresentationScheduler::Config presenterConfig;
+    presenterConfig.nominalRefreshHz = state->panelHz;
+    state->presenter = PresentationScheduler(presenterConfig);
 
     SDL_GetWindowSizeInPixels(state->window.get(), &state->width, &state->height);
     LOG("Window pixels: %d x %d", state->width, state->height);
@@ -282,46 +787,118 @@ SDL_AppResult SDL_AppInit(void** appstate, int /*argc*/, char* /*argv*/[]) {
         LOG("Failed to create GL interface");
         return SDL_APP_FAILURE;
     }
-    state->grContext = GrDirectContexts::MakeGL(state->glInterface);
-    if (!state->grContext) {
-        LOG("Failed to create Skia context");
-        return SDL_APP_FAILURE;
+    // Persistent GPU program cache. SKPLAYER_NO_PROGRAM_CACHE=1 disables it to
+    // compare cold-start timing (see the "First frame" log line).
+    state->startup.mark("gl interface", SDL_GetTicksNS());
+    const char* noProgramCache = std::getenv("SKPLAYER_NO_PROGRAM_CACHE");
+    if (!(noProgramCache && noProgramCache[0] == '1')) {
+        if (char* prefPath = SDL_GetPrefPath("skplayer", "SkiaSeekBar")) {
+            const Uint64 openStart = SDL_GetTicksNS();
+            if (!state->programCache.open(std::string(prefPath) + "programs.bin")) {
+                LOG("Program cache was corrupt - damaged entries discarded");
+            }
+            SDL_free(prefPath);
+            const auto& pc = state->programCache.stats();
+            LOG("Program cache: %zu entries (%zu KB) opened in %.2f ms", pc.entries, pc.bytes / 1024,
+                static_cast<double>(SDL_GetTicksNS() - openStart) / 1e6);
+
+            state->contextOptions.fPersistentCache = &state->programCache;
+            state->contextOptions.fShaderCacheStrategy =
+                GrContextOptions::ShaderCacheStrategy::kBackendBinary;
+        }
     }
 
-    // Set GPU resource cache budget for mobile (96MB)
-    size_t maxResourceBytes = 96 * 1024 * 1024;
-    state->grContext->setResourceCacheLimit(maxResourceBytes);
-    LOG("Set GPU resource cache limit: %zu MB", maxResourceBytes / (1024 * 1024));
+    state->startup.mark("program cache", SDL_GetTicksNS());
 
-    // Initialize shader
-    if (!state->spaceShader.initialize()) {
-        LOG("Failed to initialize shader");
+    state->grContext = GrDirectContexts::MakeGL(state->glInterface, state->contextOptions);
+    if (!state->grContext) {
+        LOG("Failed to create Skia context");
         return SDL_APP_FAILURE;
     }
-    LOG("Shader initialized");
+    state->startup.mark("skia context", SDL_GetTicksNS());
+
+    // Memory budgets: tier table sized to the device. Shares of each tier's
+    // total; caches with the lowest shed order are purged first.
+    const int systemRamMb = SDL_GetSystemRAM();
+    state->memory = std::make_unique<skplayer_ui::MemoryGovernor>(
+        skplayer_ui::MemoryGovernor::Config::ForSystemRam(static_cast<uint64_t>(std::max(systemRamMb, 0))));
+    state->gpuCache.setContext(state->grContext.get());
+    if (state->yuvRenderer) state->yuvRenderer->setContext(state->grContext.get());
+    state->memory->registerCache(&state->rasterCache, 0.10f, 1);
+    state->memory->registerCache(&state->fontCache, 0.10f, 2);
+    state->memory->registerCache(&state->gpuCache, 0.75f, 3);
+    LOG("System RAM: %d MB, memory tier %d", systemRamMb, static_cast<int>(state->memory->tier()));
+
+    state->startup.mark("memory governor", SDL_GetTicksNS());
 
     if (!state->createSurface()) {
         return SDL_APP_FAILURE;
     }
+    state->startup.mark("surface", SDL_GetTicksNS());
 
-    // Video UI container
-    state->overlayTypeface = CreateDefaultOverlayTypeface();
-    if (!state->overlayTypeface) {
-        LOG("Warning: Failed to load overlay typeface, text rendering may not work correctly");
-        // Continue anyway - VideoContainer will handle null typeface gracefully
-    }
+    // Video UI container. The overlay typeface is still loading; text uses
+    // Skia's default until collectStartupTasks() swaps it in.
+    // Library-owned caches (icons, chevron atlas, text blobs) are shed first
+    state->uiResources = skplayer_ui::ResourceContext::Make();
+    state->memory->registerCache(state->uiResources.get(), 0.05f, 0);
+
+    // SKPLAYER_NO_POINTER_PREDICTION=1 draws the drag preview at the last
+    // touch, to compare against prediction
+    const char* noPrediction = std::getenv("SKPLAYER_NO_POINTER_PREDICTION");
+    state->pointerPrediction = !(noPrediction && noPrediction[0] == '1');
+
+    if (const char* tracePath = std::getenv("SKPLAYER_TRACE")) state->tracePath = tracePath;
 
     skplayer_ui::VideoContainer::Config cfg;
-    cfg.durationSeconds = kVideoDurationSeconds;
+    cfg.durationUs = state->durationUs;
     cfg.initialLoadingSeconds = 2.0f;
     cfg.dpiScale = state->dpiScale;
-    cfg.chapters.emplace_back(0.0f, "Brittle Hollow");
-    cfg.chapters.emplace_back(42.0f, "Giant's Deep");
-    cfg.chapters.emplace_back(120.0f, "Timber Hearth");
-    cfg.overlayTypeface = state->overlayTypeface.get();
+    std::vector<skplayer_ui::Chapter> importedChapters;
+    const char* chapterFile = std::getenv("SKPLAYER_CHAPTERS");
+    const bool chaptersImported = chapterFile && ImportChapterFile(chapterFile, importedChapters);
+    if (const char* liveWindow = std::getenv("SKPLAYER_LIVE_WINDOW"); liveWindow && !state->frameSource) {
+        state->liveWindowSeconds = std::max(0.0f, static_cast<float>(std::atof(liveWindow)));
+    }
+    const bool live = state->liveWindowSeconds > 0.0f;
+    if (!state->frameSource && !chaptersImported && !live) {
+        cfg.chapters.emplace_back(0.0f, "Brittle Hollow");
+        cfg.chapters.emplace_back(42.0f, "Giant's Deep");
+        cfg.chapters.emplace_back(120.0f, "Timber Hearth");
+    }
+    cfg.resources = state->uiResources;
 
     state->videoContainer = std::make_unique<skplayer_ui::VideoContainer>(cfg, state.get());
+    if (chaptersImported && !live) state->videoContainer->setChapters(std::move(importedChapters));
+
+    // Ad-break markers in the demo; SKPLAYER_CUE_POINTS=<n> spreads n cues
+    // over the video instead (to exercise long lists)
+    if (!live) {
+        std::vector<skplayer_ui::CuePoint> cues;
+        const char* cueCount = std::getenv("SKPLAYER_CUE_POINTS");
+        const int n = cueCount ? std::max(0, std::atoi(cueCount)) : 0;
+        for (int i = 0; i < n; ++i) {
+            const skplayer_ui::MediaTimeUs t = state->durationUs * (i + 1) / (n + 1);
+            cues.push_back({static_cast<float>(skplayer_ui::media_time::toSeconds(t)), static_cast<uint32_t>(i), t});
+        }
+        if (!cueCount && !state->frameSource) cues = {{30.0f, 1}, {90.0f, 2}, {150.0f, 3}};
+        state->videoContainer->setCuePoints(std::move(cues));
+    }
+    // The shader demo resumes where a killed background session left off;
+    // live timelines and files (which may differ next launch) start over
+    if (!live && !state->frameSource) {
+        if (char* prefPath = SDL_GetPrefPath("skplayer", "SkiaSeekBar")) {
+            state->snapshotPath = std::string(prefPath) + "resume.bin";
+            SDL_free(prefPath);
+            state->restoreSnapshot();
+        }
+    }
+    if (live) {
+        LOG("Live mode: %.0f s DVR window, a segment every %d s", state->liveWindowSeconds, kLiveSegmentSeconds);
+        state->liveStartMs = SDL_GetTicks();
+        state->updateLiveWindow(state->liveStartMs);
+    }
     state->updateLayout();
+    state->startup.mark("video container", SDL_GetTicksNS());
 
     state->lastTime = SDL_GetTicks();
     *appstate = state.release();
@@ -332,14 +909,30 @@ SDL_AppResult SDL_AppEvent(void* appstate, SDL_Event* event) {
     auto state = static_cast<AppState*>(appstate);
     if (!state || !state->videoContainer) return SDL_APP_CONTINUE;
 
+    // Only events that can change what is drawn request a frame; hover
+    // motion and unhandled events must not wake an idle loop
+    const Uint32 startupEvent = state->startupEvent.load();
+    if ((startupEvent != 0 && event->type == startupEvent) ||
+        (event->type >= SDL_EVENT_WINDOW_FIRST && event->type <= SDL_EVENT_WINDOW_LAST)) {
+        state->needsFrame = true;
+    }
+
     switch (event->type) {
         case SDL_EVENT_QUIT:
             return SDL_APP_SUCCESS;
 
         case SDL_EVENT_KEY_DOWN:
+            state->needsFrame = true;
             if (event->key.key == SDLK_AC_BACK || event->key.key == SDLK_ESCAPE) {
                 return SDL_APP_SUCCESS;
             }
+            if (event->key.key == SDLK_Q && !state->frameSource) state->cycleShaderQuality();
+            if (event->key.key == SDLK_B && !state->frameSource) state->toggleShaderMode();
+            if (event->key.key == SDLK_L) {
+                state->logInputLatency();
+                state->videoContainer->resetInputLatency();
+            }
+            if (event->key.key == SDLK_S) state->logUIStats();
             break;
 
         case SDL_EVENT_WINDOW_RESIZED:
@@ -358,13 +951,20 @@ SDL_AppResult SDL_AppEvent(void* appstate, SDL_Event* event) {
                 state->isPlaying = false;
                 LOG("App backgrounding - pausing video time advancement");
             }
+            if (state->memory) state->memory->onEnterBackground();
+            state->programCache.flush();
+            state->saveSnapshot();
             break;
 
         case SDL_EVENT_DID_ENTER_FOREGROUND:
+            state->needsFrame = true;
+            state->discardSnapshot();
             LOG("App foregrounding - validating GL context");
             // Check if GL context was lost and needs recreation
             if (state->grContext && state->grContext->abandoned()) {
                 LOG("GL context was lost, recreating Skia resources");
+                // Drop plane textures while the old context still exists
+                if (state->yuvRenderer) state->yuvRenderer->setContext(nullptr);
 
                 // Recreate GL interface
                 state->glInterface = GrGLMakeNativeInterface();
@@ -374,17 +974,19 @@ SDL_AppResult SDL_AppEvent(void* appstate, SDL_Event* event) {
                 }
 
                 // Recreate Skia GPU context
-                state->grContext = GrDirectContexts::MakeGL(state->glInterface);
+                state->grContext = GrDirectContexts::MakeGL(state->glInterface, state->contextOptions);
                 if (!state->grContext) {
                     LOG("Failed to recreate Skia context");
                     return SDL_APP_FAILURE;
                 }
 
-                // Set resource cache budget
-                size_t maxResourceBytes = 96 * 1024 * 1024;  // 96MB
-                state->grContext->setResourceCacheLimit(maxResourceBytes);
+                state->gpuCache.setContext(state->grContext.get());
+                if (state->yuvRenderer) state->yuvRenderer->setContext(state->grContext.get());
             }
 
+            // Restore budgets (also applies the GPU limit to a new context)
+            if (state->memory) state->memory->onEnterForeground();
+
             // Recreate surface if needed (window size may have changed)
             if (!state->surface || !state->createSurface()) {
                 LOG("Failed to recreate surface on foreground");
@@ -393,55 +995,65 @@ SDL_AppResult SDL_AppEvent(void* appstate, SDL_Event* event) {
             break;
 
         case SDL_EVENT_LOW_MEMORY:
-            // Free GPU resources on low memory
-            if (state->grContext) {
-                LOG("Low memory warning - freeing GPU resources");
-                state->grContext->freeGpuResources();
+            // Step down one budget tier and shed caches until usage fits
+            if (state->memory) {
+                state->memory->onLowMemory();
+                state->logMemoryStats("low memory");
             }
             break;
 
         case SDL_EVENT_FINGER_DOWN: {
+            state->needsFrame = true;
             float x = event->tfinger.x * state->width - state->containerBounds.left();
             float y = event->tfinger.y * state->height - state->containerBounds.top();
-            state->videoContainer->onPointerDown(x, y, static_cast<uint64_t>(SDL_GetTicks()), false);
+            state->videoContainer->onPointerDown(x, y, static_cast<uint64_t>(SDL_GetTicks()), false,
+                                                 event->tfinger.timestamp);
             break;
         }
 
         case SDL_EVENT_FINGER_MOTION: {
+            state->needsFrame = true;
             float x = event->tfinger.x * state->width - state->containerBounds.left();
             float y = event->tfinger.y * state->height - state->containerBounds.top();
-            state->videoContainer->onPointerMove(x, y);
+            state->videoContainer->onPointerMove(x, y, event->tfinger.timestamp);
             break;
         }
 
         case SDL_EVENT_FINGER_UP: {
+            state->needsFrame = true;
             float x = event->tfinger.x * state->width - state->containerBounds.left();
             float y = event->tfinger.y * state->height - state->containerBounds.top();
-            state->videoContainer->onPointerUp(x, y);
+            state->videoContainer->onPointerUp(x, y, event->tfinger.timestamp);
             break;
         }
 
 // Mouse events for desktop only (not Android/iOS which use touch)
 #if !defined(__ANDROID__) && !(defined(__APPLE__) && TARGET_OS_IPHONE)
         case SDL_EVENT_MOUSE_BUTTON_DOWN: {
+            state->needsFrame = true;
             float x = static_cast<float>(event->button.x) - state->containerBounds.left();
             float y = static_cast<float>(event->button.y) - state->containerBounds.top();
             bool forceDoubleTap = (event->button.clicks >= 2);
-            state->videoContainer->onPointerDown(x, y, static_cast<uint64_t>(SDL_GetTicks()), forceDoubleTap);
+            state->videoContainer->onPointerDown(x, y, static_cast<uint64_t>(SDL_GetTicks()), forceDoubleTap,
+                                                 event->button.timestamp);
             break;
         }
 
         case SDL_EVENT_MOUSE_MOTION: {
+            // Hover moves nothing; only a drag (a button held) is handled
+            if (event->motion.state == 0) break;
+            state->needsFrame = true;
             float x = static_cast<float>(event->motion.x) - state->containerBounds.left();
             float y = static_cast<float>(event->motion.y) - state->containerBounds.top();
-            state->videoContainer->onPointerMove(x, y);
+            state->videoContainer->onPointerMove(x, y, event->motion.timestamp);
             break;
         }
 
         case SDL_EVENT_MOUSE_BUTTON_UP: {
+            state->needsFrame = true;
             float x = static_cast<float>(event->button.x) - state->containerBounds.left();
             float y = static_cast<float>(event->button.y) - state->containerBounds.top();
-            state->videoContainer->onPointerUp(x, y);
+            state->videoContainer->onPointerUp(x, y, event->button.timestamp);
             break;
         }
 #endif
@@ -454,31 +1066,57 @@ SDL_AppResult SDL_AppIterate(void* appstate) {
     auto state = static_cast<AppState*>(appstate);
     if (!state || !state->videoContainer) return SDL_APP_CONTINUE;
 
+    if (!state->collectStartupTasks()) return SDL_APP_FAILURE;
+    if (state->updateLiveWindow(SDL_GetTicks())) state->needsFrame = true;
+
+    // The "video" redraws every vsync while it plays. Otherwise only draw when
+    // the UI has something due, and sleep until then or until the next event.
+    const bool videoAdvancing = state->isPlaying && !state->videoContainer->isLoading();
+    if (!state->needsFrame && !videoAdvancing) {
+        const uint64_t deadline = state->videoContainer->nextDeadlineMs();
+        const Uint64 idleNow = SDL_GetTicks();
+        if (deadline > idleNow) {
+            // Purge unlocked caches once the app has been idle for a while
+            state->memory->tick(idleNow, false);
+            uint64_t wakeAt = deadline;
+            if (state->memory->idlePurgePending()) wakeAt = std::min<uint64_t>(wakeAt, idleNow + 1000);
+            if (state->liveWindowSeconds > 0.0f) {
+                wakeAt = std::min<uint64_t>(wakeAt, state->liveStartMs + (state->liveEdgeSecond + 1) * 1000ull);
+            }
+
+            Sint32 timeoutMs = (wakeAt == skplayer_ui::VideoContainer::kNoDeadline)
+                ? -1 : static_cast<Sint32>(std::min<uint64_t>(wakeAt - idleNow, INT32_MAX));
+            SDL_WaitEventTimeout(nullptr, timeoutMs);
+            return SDL_APP_CONTINUE;
+        }
+    }
+    state->needsFrame = false;
+
     Uint64 now = SDL_GetTicks();
-    float dt = (now - state->lastTime) / 1000.0f;
+    const Uint64 elapsedMs = now - state->lastTime;
+    float dt = elapsedMs / 1000.0f;
     state->lastTime = now;
 
-    // Update video time if playing (and not loading)
-    if (state->isPlaying && !state->videoContainer->isLoading()) {
-        state->videoTime += dt;
-        if (state->videoTime >= kVideoDurationSeconds) {
-            state->videoTime = kVideoDurationSeconds;
-            // Video ended - VideoContainer handles the pause
-        }
-        state->spaceShader.setTime(state->videoTime);
+    // Update video time if playing (and not loading). Whole ticks, so hours
+    // of playback don't drift; the end is the video's or the live edge.
+    if (videoAdvancing) {
+        const auto elapsed = skplayer_ui::media_time::fromMillis(static_cast<int64_t>(elapsedMs));
+        state->setVideoTime(std::min(state->videoTimeUs + elapsed, state->playbackEnd()));
     }
 
     state->videoContainer->update(dt, static_cast<uint64_t>(now));
+    state->applyFrameRate();
+    if (state->pointerPrediction) {
+        const double vsync = state->presenter.predictNextVsync(static_cast<double>(SDL_GetTicksNS()) / 1e9);
+        state->videoContainer->setExpectedPresentTime(static_cast<uint64_t>(vsync * 1e9));
+    }
 
     SkCanvas* canvas = state->surface->getCanvas();
     
     // Clear background (black for letterboxing)
     canvas->clear(SK_ColorBLACK);
 
-    // Render shader as the "video"
-    if (state->spaceShader.isReady()) {
-        state->spaceShader.render(canvas, state->videoBounds);
-    }
+    state->renderVideo(canvas, videoAdvancing);
 
     // Render VideoContainer UI overlay
     // In portrait mode, this renders at the bottom; in landscape, it overlays the video
@@ -489,14 +1127,46 @@ SDL_AppResult SDL_AppIterate(void* appstate) {
 
     state->grContext->flush();
     SDL_GL_SwapWindow(state->window.get());
+    // Swap return stands in for the photon time; input events carry
+    // timestamps on the same SDL_GetTicksNS() clock
+    const Uint64 presentedNs = SDL_GetTicksNS();
+    state->videoContainer->onFramePresented(presentedNs);
+    state->onFramePresented(videoAdvancing);
+    state->memory->tick(now, true);
+
+    // Programs compiled for the first frame are persisted right away
+    if (!state->firstFramePresented) {
+        state->firstFramePresented = true;
+        state->startup.mark("first frame", presentedNs);
+        LOG("Time to first frame: %.1f ms", state->startup.sinceLaunchMs(presentedNs));
+        state->programCache.flush();
+    }
+    if (!state->startupReported && state->videoDrawn && !state->startupPending()) {
+        // First frame with the video and final text; includes GPU program
+        // creation for the shader (see the program cache counters)
+        state->startupReported = true;
+        state->startup.mark("video visible", presentedNs);
+        LOG("Time to video: %.1f ms", state->startup.sinceLaunchMs(presentedNs));
+        state->logStartup();
+        state->programCache.flush();
+    }
     return SDL_APP_CONTINUE;
 }
 
 void SDL_AppQuit(void* appstate, SDL_AppResult /*result*/) {
     std::unique_ptr<AppState> state(static_cast<AppState*>(appstate));
     if (state) {
+        state->programCache.flush();
+        state->logFrameSourceStats();
+        state->logInputLatency();
+        state->logUIStats();
+        state->exportTrace();
+        state->discardSnapshot();
+
         // 1. Destroy Skia resources (requires valid GL context)
+        state->memory.reset();
         state->videoContainer.reset();
+        state->yuvRenderer.reset();  // Frees plane textures
         state->surface.reset();
 
         // 2. Flush and abandon Skia GPU context
@@ -0,0 +1,20 @@
+// tests/Check.h
+#pragma once
+
+#include <cstdio>
+
+// Minimal assertion for the host tests: reports and counts failures so one
+// run shows all of them. main() returns CheckFailures() != 0.
+inline int& CheckFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(cond)                                                            \
+    do {                                                                       \
+        if (!(cond)) {                                                         \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__,        \
+                         __LINE__, #cond);                                     \
+            ++CheckFailures();                                                 \
+        }                                                                      \
+    } while (0)
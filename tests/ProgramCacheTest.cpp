@@ -0,0 +1,191 @@
+// tests/ProgramCacheTest.cpp
+//
+// ProgramCache against real files in a fresh temporary directory: round
+// trip, milestone mismatch, a damaged entry, and both eviction rules.
+
+#include "Check.h"
+#include "ProgramCache.h"
+
+#include "include/core/SkTypes.h"  // SK_MILESTONE
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+
+namespace {
+
+sk_sp<SkData> Bytes(const char* s) { return SkData::MakeWithCopy(s, std::strlen(s)); }
+
+bool Holds(ProgramCache& cache, const char* key, const char* value) {
+    sk_sp<SkData> data = cache.load(*Bytes(key));
+    return data && data->size() == std::strlen(value) &&
+           std::memcmp(data->data(), value, data->size()) == 0;
+}
+
+void Store(ProgramCache& cache, const char* key, const char* value) {
+    cache.store(*Bytes(key), *Bytes(value), SkString());
+}
+
+bool Exists(const std::string& path) { return ::access(path.c_str(), F_OK) == 0; }
+
+// Overwrites `size` bytes at `offset` (negative = from the end)
+void Patch(const std::string& path, long offset, const void* bytes, size_t size) {
+    FILE* f = std::fopen(path.c_str(), "r+b");
+    if (!f) return;
+    std::fseek(f, offset, offset < 0 ? SEEK_END : SEEK_SET);
+    std::fwrite(bytes, 1, size, f);
+    std::fclose(f);
+}
+
+void TestRoundTrip(const std::string& path) {
+    {
+        ProgramCache cache;
+        CHECK(cache.open(path));  // Missing file = empty cache
+        CHECK(cache.stats().entries == 0);
+        Store(cache, "vs:1", "program one");
+        Store(cache, "fs:2", "program two");
+        CHECK(Holds(cache, "fs:2", "program two"));
+        CHECK(cache.flush());
+    }
+    ProgramCache cache;
+    CHECK(cache.open(path));
+    CHECK(cache.stats().entries == 2);
+    CHECK(!cache.stats().corrupt);
+    CHECK(Holds(cache, "vs:1", "program one"));
+    CHECK(Holds(cache, "fs:2", "program two"));
+    CHECK(!cache.load(*Bytes("missing")));
+    CHECK(cache.stats().hits == 2 && cache.stats().misses == 1);
+
+    // Replacing a value keeps one entry
+    Store(cache, "vs:1", "program one, v2");
+    CHECK(cache.stats().entries == 2);
+    CHECK(cache.flush());
+    ProgramCache reopened;
+    CHECK(reopened.open(path));
+    CHECK(Holds(reopened, "vs:1", "program one, v2"));
+}
+
+void TestMilestoneMismatch(const std::string& path) {
+    {
+        ProgramCache cache;
+        cache.open(path);
+        Store(cache, "vs:1", "program one");
+        CHECK(cache.flush());
+    }
+    // FileHeader: magic[4], formatVersion, skiaMilestone, ...
+    const uint32_t otherMilestone = SK_MILESTONE + 1;
+    Patch(path, 8, &otherMilestone, sizeof(otherMilestone));
+
+    ProgramCache cache;
+    CHECK(cache.open(path));  // Valid file, just not ours: not corrupt
+    CHECK(!cache.stats().corrupt);
+    CHECK(cache.stats().entries == 0);
+    CHECK(!Exists(path));     // Discarded
+    CHECK(!cache.load(*Bytes("vs:1")));
+}
+
+void TestCorruptEntry(const std::string& path) {
+    {
+        ProgramCache cache;
+        cache.open(path);
+        Store(cache, "vs:1", "program one");
+        Store(cache, "fs:2", "program two");
+        Store(cache, "fs:3", "program six");  // Same length: same padding
+        CHECK(cache.flush());
+    }
+    // Damage the last entry's value: 24 + 4 + 11 bytes leave one byte of
+    // padding, so the sixth byte from the end is inside the value
+    Patch(path, -6, "X", 1);
+
+    {
+        ProgramCache cache;
+        CHECK(!cache.open(path));
+        CHECK(cache.stats().corrupt);
+        CHECK(cache.stats().entries == 2);
+        CHECK(cache.flush());  // Rewritten without the damaged entry
+    }
+    ProgramCache cache;
+    CHECK(cache.open(path));
+    CHECK(!cache.stats().corrupt);
+    CHECK(cache.stats().entries == 2);
+}
+
+void TestIdleEviction(const std::string& path) {
+    {
+        ProgramCache cache;
+        cache.open(path);
+        Store(cache, "stale", "old shader");
+        Store(cache, "fresh", "live shader");
+        CHECK(cache.flush());
+    }
+    // One session per flush; only "fresh" is used. "stale" survives
+    // kMaxIdleSessions unused sessions and goes on the flush after that.
+    for (uint32_t session = 0; session <= ProgramCache::kMaxIdleSessions; ++session) {
+        ProgramCache cache;
+        CHECK(cache.open(path));
+        CHECK(cache.stats().entries == 2);
+        CHECK(Holds(cache, "fresh", "live shader"));
+        CHECK(cache.flush());
+    }
+    ProgramCache cache;
+    CHECK(cache.open(path));
+    CHECK(cache.stats().entries == 1);
+    CHECK(!cache.load(*Bytes("stale")));
+    CHECK(Holds(cache, "fresh", "live shader"));
+}
+
+void TestSizeEviction(const std::string& path) {
+    // Three 10-byte values against a 25-byte cap: the least recently used goes
+    {
+        ProgramCache cache(25);
+        cache.open(path);
+        Store(cache, "a", "0123456789");
+        CHECK(cache.flush());
+    }
+    {
+        ProgramCache cache(25);
+        cache.open(path);
+        Store(cache, "b", "0123456789");
+        CHECK(cache.flush());
+    }
+    {
+        ProgramCache cache(25);
+        cache.open(path);
+        CHECK(Holds(cache, "a", "0123456789"));  // "b" is now the oldest
+        Store(cache, "c", "0123456789");
+        CHECK(cache.flush());
+        CHECK(cache.stats().evicted == 1);
+    }
+    ProgramCache cache(25);
+    CHECK(cache.open(path));
+    CHECK(cache.stats().entries == 2);
+    CHECK(!cache.load(*Bytes("b")));
+    CHECK(Holds(cache, "a", "0123456789"));
+    CHECK(Holds(cache, "c", "0123456789"));
+}
+
+} // namespace
+
+int main() {
+    char dirTemplate[] = "/tmp/skplayer_program_cache_XXXXXX";
+    const char* dir = ::mkdtemp(dirTemplate);
+    if (!dir) {
+        std::perror("mkdtemp");
+        return 1;
+    }
+
+    int n = 0;
+    for (void (*test)(const std::string&) :
+         {TestRoundTrip, TestMilestoneMismatch, TestCorruptEntry, TestIdleEviction, TestSizeEviction}) {
+        const std::string path = std::string(dir) + "/cache" + std::to_string(n++) + ".bin";
+        test(path);
+        std::remove(path.c_str());
+    }
+    ::rmdir(dir);
+
+    if (CheckFailures()) std::fprintf(stderr, "%d check(s) failed\n", CheckFailures());
+    return CheckFailures() != 0;
+}
@@ -0,0 +1,44 @@
+// tests/bench/Bench.h
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#endif
+
+namespace bench {
+
+using Clock = std::chrono::steady_clock;
+
+inline double msSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Bytes currently allocated from the C heap (Skia's allocations included),
+// or 0 where the allocator can't tell
+inline size_t heapBytes() {
+#if defined(__GLIBC__)
+    return mallinfo2().uordblks;
+#elif defined(__APPLE__)
+    return mstats().bytes_used;
+#else
+    return 0;
+#endif
+}
+
+// Each benchmark takes the arguments after its name and returns a process
+// exit code
+int RunContainers(int argc, char** argv);
+int RunStartup(int argc, char** argv);
+int RunTiles(int argc, char** argv);
+int RunTiers(int argc, char** argv);
+int RunBaked(int argc, char** argv);
+int RunChapters(int argc, char** argv);
+int RunResume(int argc, char** argv);
+int RunYuv(int argc, char** argv);
+
+} // namespace bench
@@ -0,0 +1,46 @@
+// tests/bench/BenchMain.cpp
+
+#include "Bench.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+struct Benchmark {
+    const char* name;
+    const char* usage;
+    int (*run)(int argc, char** argv);
+};
+
+constexpr Benchmark kBenchmarks[] = {
+    {"containers", "[count=500]  construct and draw a feed of containers, private vs shared ResourceContext",
+     bench::RunContainers},
+    {"startup", "cold launch work without a window: shader compile, typeface, first UI and video frames",
+     bench::RunStartup},
+    {"tiles", "[WxH=640x360] [tile=64]  video shader on the CPU in tiles, 1 thread up to one per core",
+     bench::RunTiles},
+    {"tiers", "[WxH=640x360]  video shader frame time per quality tier, all cores",
+     bench::RunTiers},
+    {"baked", "[WxH=640x360]  starfield bake and cache load, then baked vs live shader frame time",
+     bench::RunBaked},
+    {"chapters", "[count=100000] [file...]  chapter import throughput, generated lists or the given files",
+     bench::RunChapters},
+    {"resume", "[chapters...=10000 100000]  cold resume, fresh container re-parsing chapters vs snapshot restore",
+     bench::RunResume},
+    {"yuv", "[WxH=1280x720] [frames=120]  raster YUV frame draw, Skia-side conversion vs CPU convert",
+     bench::RunYuv},
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc >= 2) {
+        for (const Benchmark& b : kBenchmarks) {
+            if (std::strcmp(argv[1], b.name) == 0) return b.run(argc - 2, argv + 2);
+        }
+    }
+    std::fprintf(stderr, "usage: %s <benchmark> [args]\n", argc > 0 ? argv[0] : "skplayer_bench");
+    for (const Benchmark& b : kBenchmarks) std::fprintf(stderr, "  %-12s %s\n", b.name, b.usage);
+    return 2;
+}
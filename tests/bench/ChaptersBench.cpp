@@ -0,0 +1,112 @@
+// tests/bench/ChaptersBench.cpp
+//
+// ImportChapters() throughput. Without files, on generated lists in each
+// format; with files, on those (memory-mapped and prefetched, so the parse is
+// timed rather than page faults).
+
+#include "Bench.h"
+
+#include "MappedFile.h"
+
+#include "skplayer_ui/ChapterImport.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+namespace {
+
+using skplayer_ui::ChapterFormat;
+
+// One chapter every 7 s, as in the resume benchmark
+std::string Generate(ChapterFormat format, int count) {
+    std::string out;
+    out.reserve(static_cast<size_t>(count) * 64);
+    char line[128];
+    if (format == ChapterFormat::WebVTT) out += "WEBVTT\n\n";
+    if (format == ChapterFormat::Json) out += "{\"chapters\": [\n";
+    for (int i = 0; i < count; ++i) {
+        const int s = i * 7, e = s + 7;
+        switch (format) {
+            case ChapterFormat::WebVTT:
+                std::snprintf(line, sizeof(line), "%d\n%02d:%02d:%02d.000 --> %02d:%02d:%02d.000\nChapter %d\n\n",
+                              i + 1, s / 3600, s / 60 % 60, s % 60, e / 3600, e / 60 % 60, e % 60, i + 1);
+                break;
+            case ChapterFormat::Json:
+                std::snprintf(line, sizeof(line), "  {\"start\": %d, \"title\": \"Chapter %d\"}%s\n", s, i + 1,
+                              i + 1 < count ? "," : "");
+                break;
+            default:
+                std::snprintf(line, sizeof(line), "%d:%02d:%02d Chapter %d\n", s / 3600, s / 60 % 60, s % 60, i + 1);
+                break;
+        }
+        out += line;
+    }
+    if (format == ChapterFormat::Json) out += "]}\n";
+    return out;
+}
+
+const char* FormatName(ChapterFormat format) {
+    switch (format) {
+        case ChapterFormat::WebVTT: return "webvtt";
+        case ChapterFormat::Json: return "json";
+        case ChapterFormat::Description: return "description";
+        default: return "auto";
+    }
+}
+
+// Best of a few runs; false if the input doesn't parse
+bool Measure(const char* label, const char* data, size_t size) {
+    constexpr int kRuns = 5;
+    double best = 1e30;
+    skplayer_ui::ChapterImportResult result;
+    for (int run = 0; run < kRuns; ++run) {
+        std::vector<skplayer_ui::Chapter> chapters;
+        const auto start = Clock::now();
+        result = skplayer_ui::ImportChapters(data, size, chapters);
+        best = std::min(best, msSince(start));
+        if (!result.ok) {
+            std::fprintf(stderr, "chapters: %s: %s (line %zu)\n", label, result.error, result.errorLine);
+            return false;
+        }
+    }
+    const double mb = static_cast<double>(size) / (1024.0 * 1024.0);
+    const double perSecond = best > 0.0 ? 1e3 / best : 0.0;
+    std::printf("  %-12s %-11s %9zu chapters %8.2f MB %8.2f ms %7.0f MB/s %10.0f chapters/s\n", label,
+                FormatName(result.format), result.chapters, mb, best, mb * perSecond,
+                static_cast<double>(result.chapters) * perSecond);
+    return true;
+}
+
+} // namespace
+
+int RunChapters(int argc, char** argv) {
+    const int count = argc > 0 ? std::max(1, std::atoi(argv[0])) : 100000;
+    bool ok = true;
+    if (argc > 1) {
+        for (int i = 1; i < argc; ++i) {
+            auto file = MappedFile::OpenReadOnly(argv[i]);
+            if (!file) {
+                std::fprintf(stderr, "chapters: could not open '%s'\n", argv[i]);
+                ok = false;
+                continue;
+            }
+            file->prefetch(0, file->size());
+            ok &= Measure(argv[i], reinterpret_cast<const char*>(file->data()), file->size());
+        }
+        return ok ? 0 : 1;
+    }
+
+    std::printf("%d generated chapters per format, best of 5\n", count);
+    for (auto format : {ChapterFormat::WebVTT, ChapterFormat::Json, ChapterFormat::Description}) {
+        const std::string text = Generate(format, count);
+        ok &= Measure("generated", text.data(), text.size());
+    }
+    return ok ? 0 : 1;
+}
+
+} // namespace bench
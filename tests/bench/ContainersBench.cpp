@@ -0,0 +1,99 @@
+// tests/bench/ContainersBench.cpp
+//
+// A feed of inline players: `count` containers built and drawn once, each
+// with a private ResourceContext (the default) and then all sharing one.
+// Reports construction and first-frame time and the heap the containers
+// hold while alive.
+
+#include "Bench.h"
+
+#include "skplayer_ui/ResourceContext.h"
+#include "skplayer_ui/VideoContainer.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkSurface.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace bench {
+
+namespace {
+
+constexpr int kWidth = 360, kHeight = 640;  // Portrait feed item
+
+struct FeedResult {
+    double constructMs = 0.0;
+    double firstFrameMs = 0.0;
+    size_t heapBytes = 0;
+};
+
+FeedResult runFeed(int count, bool shared, SkCanvas* canvas) {
+    using namespace skplayer_ui;
+
+    FeedResult r;
+    const size_t heapBefore = heapBytes();
+    {
+        std::shared_ptr<ResourceContext> context = shared ? ResourceContext::Make() : nullptr;
+        std::vector<std::unique_ptr<VideoContainer>> feed;
+        feed.reserve(static_cast<size_t>(count));
+
+        const auto t0 = Clock::now();
+        for (int i = 0; i < count; ++i) {
+            VideoContainer::Config cfg;
+            cfg.durationSeconds = 600.0f;
+            cfg.chapters = {Chapter(0.0f, "Intro"), Chapter(42.0f, "Part one"), Chapter(120.0f, "Part two")};
+            cfg.resources = context;
+            auto c = std::make_unique<VideoContainer>(cfg);
+            c->setViewport(kWidth, kHeight);
+            c->setLayout(true, kHeight / 4.0f);
+            feed.push_back(std::move(c));
+        }
+        r.constructMs = msSince(t0);
+
+        const auto t1 = Clock::now();
+        for (auto& c : feed) {
+            c->update(1.0f / 60.0f, 16);
+            c->render(canvas);
+        }
+        r.firstFrameMs = msSince(t1);
+        r.heapBytes = heapBytes() - heapBefore;
+    }
+    return r;
+}
+
+} // namespace
+
+int RunContainers(int argc, char** argv) {
+    const int count = argc > 0 ? std::max(1, std::atoi(argv[0])) : 500;
+    constexpr int kRuns = 5;
+
+    sk_sp<SkSurface> surface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(kWidth, kHeight));
+    if (!surface) {
+        std::fprintf(stderr, "containers: could not create a raster surface\n");
+        return 1;
+    }
+
+    std::printf("%d containers, %dx%d, best of %d runs\n", count, kWidth, kHeight, kRuns);
+    for (bool shared : {false, true}) {
+        runFeed(count, shared, surface->getCanvas());  // Warm-up: code paths, glyph caches
+
+        FeedResult best{1e30, 1e30, 0};
+        for (int run = 0; run < kRuns; ++run) {
+            const FeedResult r = runFeed(count, shared, surface->getCanvas());
+            best.constructMs = std::min(best.constructMs, r.constructMs);
+            best.firstFrameMs = std::min(best.firstFrameMs, r.firstFrameMs);
+            best.heapBytes = std::max(best.heapBytes, r.heapBytes);
+        }
+        std::printf("  %-7s construct %8.2f ms (%6.1f us each), first frame %8.2f ms, heap %8zu KB (%6.1f KB each)\n",
+                    shared ? "shared" : "private", best.constructMs, best.constructMs * 1000.0 / count,
+                    best.firstFrameMs, best.heapBytes / 1024, best.heapBytes / 1024.0 / count);
+    }
+    return 0;
+}
+
+} // namespace bench
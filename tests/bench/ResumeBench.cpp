@@ -0,0 +1,97 @@
+// tests/bench/ResumeBench.cpp
+//
+// Cold resume two ways, headless: a fresh container built from Config that
+// re-parses the chapter list (description text), against one restored from
+// a snapshot of the same state. Both read from memory, so the numbers are
+// the CPU cost.
+
+#include "Bench.h"
+
+#include "skplayer_ui/ChapterImport.h"
+#include "skplayer_ui/ResourceContext.h"
+#include "skplayer_ui/VideoContainer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+namespace {
+
+constexpr int kWidth = 1080, kHeight = 720;
+
+// Averaged over kRuns; false if a container fails to build or restore
+bool Measure(int chapterCount) {
+    using namespace skplayer_ui;
+    constexpr int kRuns = 20;
+
+    // One chapter every 7 s, as in the chapters benchmark
+    std::string text;
+    for (int i = 0; i < chapterCount; ++i) {
+        char line[64];
+        const int s = i * 7;
+        std::snprintf(line, sizeof(line), "%d:%02d:%02d Chapter %d\n", s / 3600, s / 60 % 60, s % 60, i + 1);
+        text += line;
+    }
+
+    VideoContainer::Config cfg;
+    cfg.durationUs = media_time::fromSeconds(static_cast<double>(chapterCount) * 7.0 + 60.0);
+    cfg.resources = ResourceContext::Make();
+
+    // Fresh: what a killed activity does without a snapshot
+    auto fresh = [&]() -> std::unique_ptr<VideoContainer> {
+        std::vector<Chapter> chapters;
+        if (!ImportChapters(text.data(), text.size(), chapters).ok) return nullptr;
+        auto c = std::make_unique<VideoContainer>(cfg);
+        c->setChapters(std::move(chapters));
+        c->setViewport(kWidth, kHeight);
+        c->setLayout(false, kHeight / 2.0f);
+        return c;
+    };
+
+    auto source = fresh();
+    if (!source) return false;
+    source->update(1.0f / 60.0f, 0);
+    const std::vector<uint8_t> bytes = source->snapshot();
+
+    double freshMs = 0.0, restoreMs = 0.0;
+    for (int run = 0; run < kRuns; ++run) {
+        const auto t0 = Clock::now();
+        auto a = fresh();
+        freshMs += msSince(t0);
+        const auto t1 = Clock::now();
+        auto b = std::make_unique<VideoContainer>(cfg);
+        const bool restored = b->restore(bytes.data(), bytes.size(), 0);
+        restoreMs += msSince(t1);
+        if (!a || !restored || b->positionUs() != source->positionUs()) return false;
+    }
+    freshMs /= kRuns;
+    restoreMs /= kRuns;
+    std::printf("  %7d chapters, %6zu KB text, %6zu KB snapshot: fresh + parse %8.3f ms, restore %8.3f ms (%.1fx)\n",
+                chapterCount, text.size() / 1024, bytes.size() / 1024, freshMs, restoreMs,
+                restoreMs > 0.0 ? freshMs / restoreMs : 0.0);
+    return true;
+}
+
+} // namespace
+
+int RunResume(int argc, char** argv) {
+    std::vector<int> counts;
+    for (int i = 0; i < argc; ++i) counts.push_back(std::max(1, std::atoi(argv[i])));
+    if (counts.empty()) counts = {10000, 100000};
+
+    std::printf("Resume, %dx%d, mean of 20 runs\n", kWidth, kHeight);
+    for (int count : counts) {
+        if (!Measure(count)) {
+            std::fprintf(stderr, "resume: %d chapters: build or restore failed\n", count);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+} // namespace bench
@@ -0,0 +1,155 @@
+// tests/bench/ShaderBench.cpp
+//
+// The video shader on the CPU through TiledRenderer: how the tiled raster
+// path scales with threads, what each quality tier costs, and the baked
+// starfield against the live shader.
+
+#include "Bench.h"
+
+#include "SpaceExplorationShader.h"
+#include "StarfieldBake.h"
+#include "TiledRenderer.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkSurface.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+namespace bench {
+
+namespace {
+
+struct ShaderTarget {
+    int width = 640, height = 360;
+    sk_sp<SkSurface> surface;
+    SpaceExplorationShader shader;
+
+    // [WxH] as the first argument
+    bool init(int argc, char** argv, const char* name) {
+        if (argc > 0 && std::sscanf(argv[0], "%dx%d", &width, &height) != 2) {
+            std::fprintf(stderr, "%s: size must be WxH\n", name);
+            return false;
+        }
+        surface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(width, height));
+        if (!surface || !shader.initialize()) {
+            std::fprintf(stderr, "%s: no raster surface or shader\n", name);
+            return false;
+        }
+        return true;
+    }
+
+    // Tile-rendering ms per frame (TiledRenderer::Stats) over `frames`
+    // frames of animation, after one warm-up frame
+    double frameMs(TiledRenderer& renderer, int frames) {
+        const SkRect bounds = SkRect::MakeWH(static_cast<float>(width), static_cast<float>(height));
+        auto draw = [&](SkCanvas* tile) { shader.render(tile, bounds); };
+        shader.setTime(0.0f);
+        renderer.render(surface->getCanvas(), bounds, draw);
+        renderer.resetStats();
+        for (int f = 1; f <= frames; ++f) {
+            shader.setTime(static_cast<float>(f) / 60.0f);
+            renderer.render(surface->getCanvas(), bounds, draw);
+        }
+        return renderer.stats().averageMs;
+    }
+};
+
+} // namespace
+
+int RunTiles(int argc, char** argv) {
+    ShaderTarget target;
+    if (!target.init(argc, argv, "tiles")) return 1;
+    TiledRenderer::Config config;
+    if (argc > 1) config.tileSize = std::atoi(argv[1]);
+    constexpr int kFrames = 5;
+
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::printf("%dx%d, %d px tiles, %s tier, %d frames per run\n", target.width, target.height,
+                std::max(config.tileSize, 8), SpaceExplorationShader::TierFor(target.shader.quality()).name,
+                kFrames);
+    std::printf("  threads  ms/frame  speedup  efficiency\n");
+    double single = 0.0;
+    for (unsigned threads = 1;; threads = std::min(threads * 2, cores)) {
+        config.threads = threads;
+        TiledRenderer renderer(config);
+        const double ms = target.frameMs(renderer, kFrames);
+        if (threads == 1) single = ms;
+        const double speedup = ms > 0.0 ? single / ms : 0.0;
+        std::printf("  %7u  %8.2f  %6.2fx  %9.0f%%\n", threads, ms, speedup, 100.0 * speedup / threads);
+        if (threads == cores) break;
+    }
+    return 0;
+}
+
+int RunTiers(int argc, char** argv) {
+    ShaderTarget target;
+    if (!target.init(argc, argv, "tiers")) return 1;
+    constexpr int kFrames = 5;
+
+    TiledRenderer renderer(TiledRenderer::Config{});  // One thread per core
+    std::printf("%dx%d, %u threads, %d frames per tier\n", target.width, target.height, renderer.threadCount(),
+                kFrames);
+    std::printf("  tier    iterations  volsteps  ms/frame  vs ultra\n");
+
+    double ms[SpaceExplorationShader::kQualityCount] = {};
+    for (int i = 0; i < SpaceExplorationShader::kQualityCount; ++i) {
+        target.shader.setQuality(static_cast<SpaceExplorationShader::Quality>(i));
+        ms[i] = target.frameMs(renderer, kFrames);
+    }
+    const double ultra = ms[SpaceExplorationShader::kQualityCount - 1];
+    for (int i = 0; i < SpaceExplorationShader::kQualityCount; ++i) {
+        const auto tier = SpaceExplorationShader::TierFor(static_cast<SpaceExplorationShader::Quality>(i));
+        std::printf("  %-6s  %10d  %8d  %8.2f  %7.0f%%\n", tier.name, tier.iterations, tier.volsteps, ms[i],
+                    ultra > 0.0 ? 100.0 * ms[i] / ultra : 0.0);
+    }
+    return 0;
+}
+
+int RunBaked(int argc, char** argv) {
+    ShaderTarget target;
+    if (!target.init(argc, argv, "baked")) return 1;
+    constexpr int kFrames = 5;
+
+    // Bake into a fresh cache file, then map it back as a later launch would
+    char dirTemplate[] = "/tmp/skplayer_starfield_XXXXXX";
+    const char* dir = ::mkdtemp(dirTemplate);
+    if (!dir) {
+        std::perror("mkdtemp");
+        return 1;
+    }
+    const std::string cachePath = std::string(dir) + "/starfield.bin";
+    const StarfieldBake::Result baked = StarfieldBake::LoadOrBake(cachePath);
+    const auto loadStart = Clock::now();
+    const StarfieldBake::Result cached = StarfieldBake::LoadOrBake(cachePath);
+    const double loadMs = msSince(loadStart);
+    if (!baked.image || !cached.fromCache) {
+        std::fprintf(stderr, "baked: bake or cache reload failed\n");
+        return 1;
+    }
+
+    TiledRenderer renderer(TiledRenderer::Config{});  // One thread per core
+    const double liveMs = target.frameMs(renderer, kFrames);
+    target.shader.setMode(SpaceExplorationShader::Mode::kBaked);
+    target.shader.setBakedField(cached.image);
+    const double bakedMs = target.frameMs(renderer, kFrames);
+
+    std::remove(cachePath.c_str());  // The mapping outlives the unlink
+    ::rmdir(dir);
+
+    std::printf("%dx%d, %u threads, %s tier live, %d px field\n", target.width, target.height,
+                renderer.threadCount(), SpaceExplorationShader::TierFor(target.shader.quality()).name,
+                baked.image->width());
+    std::printf("  bake          %8.2f ms (once)\n", baked.bakeMs);
+    std::printf("  cache load    %8.3f ms (later launches)\n", loadMs);
+    std::printf("  live frame    %8.2f ms\n", liveMs);
+    std::printf("  baked frame   %8.2f ms (%.0fx faster)\n", bakedMs, bakedMs > 0.0 ? liveMs / bakedMs : 0.0);
+    return 0;
+}
+
+} // namespace bench
@@ -0,0 +1,96 @@
+// tests/bench/StartupBench.cpp
+//
+// The launch work that needs no window or GL context, cold, once per
+// process (run it in a loop for a distribution): SkSL compilation, the
+// typeface lookup, and building and drawing the first UI and video frames on
+// a raster surface. Window, GL and GPU program creation only exist in the
+// app, which logs its full phase table on every launch.
+
+#include "Bench.h"
+
+#include "OverlayTypefaceProvider.h"
+#include "SpaceExplorationShader.h"
+
+#include "skplayer_ui/ResourceContext.h"
+#include "skplayer_ui/VideoContainer.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkSurface.h"
+#include "include/core/SkTypeface.h"
+
+#include <cstdio>
+#include <memory>
+
+namespace bench {
+
+int RunStartup(int /*argc*/, char** /*argv*/) {
+    using namespace skplayer_ui;
+    constexpr int kWidth = 1280, kHeight = 720;
+
+    sk_sp<SkSurface> surface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(kWidth, kHeight));
+    if (!surface) {
+        std::fprintf(stderr, "startup: could not create a raster surface\n");
+        return 1;
+    }
+    SkCanvas* canvas = surface->getCanvas();
+    const SkRect bounds = SkRect::MakeWH(kWidth, kHeight);
+
+    std::printf("Startup work without a window, %dx%d raster (ms):\n", kWidth, kHeight);
+    auto report = [](const char* phase, double ms) { std::printf("  %-22s %8.2f\n", phase, ms); };
+
+    auto t = Clock::now();
+    sk_sp<SkRuntimeEffect> effect = SpaceExplorationShader::Compile();
+    report("shader compile", msSince(t));
+    if (!effect) {
+        std::fprintf(stderr, "startup: shader failed to compile\n");
+        return 1;
+    }
+
+    t = Clock::now();
+    SpaceExplorationShader::Compile();
+    report("shader compile again", msSince(t));  // In-process effect cache
+
+    t = Clock::now();
+    sk_sp<SkTypeface> typeface = CreateDefaultOverlayTypeface();
+    report(typeface ? "typeface load" : "typeface (none)", msSince(t));
+
+    // As in SDL_AppInit: the container starts on Skia's default typeface
+    t = Clock::now();
+    auto resources = ResourceContext::Make();
+    VideoContainer::Config cfg;
+    cfg.durationSeconds = 194.0f;
+    cfg.initialLoadingSeconds = 2.0f;
+    cfg.chapters = {Chapter(0.0f, "Brittle Hollow"), Chapter(42.0f, "Giant's Deep"),
+                    Chapter(120.0f, "Timber Hearth")};
+    cfg.resources = resources;
+    VideoContainer container(cfg);
+    container.setViewport(kWidth, kHeight);
+    container.setLayout(false, kHeight / 2.0f);
+    report("video container", msSince(t));
+
+    t = Clock::now();
+    container.update(0.0f, 0);
+    container.render(canvas);
+    report("first UI frame", msSince(t));
+
+    t = Clock::now();
+    resources->setTypeface(typeface.get());
+    container.update(1.0f / 60.0f, 16);
+    container.render(canvas);
+    report("typeface swap + frame", msSince(t));
+
+    SpaceExplorationShader shader;
+    shader.setEffect(effect);
+    t = Clock::now();
+    shader.render(canvas, bounds);
+    report("first video frame", msSince(t));
+
+    t = Clock::now();
+    shader.setTime(1.0f / 60.0f);
+    shader.render(canvas, bounds);
+    report("second video frame", msSince(t));
+    return 0;
+}
+
+} // namespace bench